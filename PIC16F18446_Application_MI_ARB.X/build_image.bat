@@ -13,6 +13,10 @@ if "%1"=="" (set IS_DEBUG=false) else (set IS_DEBUG=%1)
 if "%2"=="" (set INPUT_IMAGE_PATH=".\dist\Standalone\production\PIC16F18446_Application.X.production.hex") else (set INPUT_IMAGE_PATH=%2)
 REM - relative path to client config file
 set CONFIG_FILE_PATH="..\PIC16F18446_Client.X\mcc_generated_files\bootloader\configurations\bootloader_configuration.toml"
+REM - With the slot swap install mode, an image that will be sent to the staging area is built from the Slot1 configuration (code offset 3000h) with this config file
+REM set CONFIG_FILE_PATH="..\PIC16F18446_Client.X\mcc_generated_files\bootloader\configurations\bootloader_configuration_slot1.toml"
+REM - With the back-up image restoration enabled, an image is built from the Backup configuration (0xAA0 word image space) with this config file
+REM set CONFIG_FILE_PATH="..\PIC16F18446_Client.X\mcc_generated_files\bootloader\configurations\bootloader_configuration_backup.toml"
 REM For creating new images, update the image file name below and uncomment the line
 set OUTPUT_IMAGE_PATH=".\Application_Binary_v1.img" 
 
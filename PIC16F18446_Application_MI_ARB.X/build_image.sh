@@ -23,6 +23,10 @@ else
 fi
 # - relative path to client config file
 CONFIG_FILE_PATH="../PIC16F18446_Client.X/mcc_generated_files/bootloader/configurations/bootloader_configuration.toml"
+# - With the slot swap install mode, an image that will be sent to the staging area is built from the Slot1 configuration (code offset 3000h) with this config file
+# CONFIG_FILE_PATH="../PIC16F18446_Client.X/mcc_generated_files/bootloader/configurations/bootloader_configuration_slot1.toml"
+# - With the back-up image restoration enabled, an image is built from the Backup configuration (0xAA0 word image space) with this config file
+# CONFIG_FILE_PATH="../PIC16F18446_Client.X/mcc_generated_files/bootloader/configurations/bootloader_configuration_backup.toml"
 # For creating new images, update the image file name below and uncomment the line
 OUTPUT_IMAGE_PATH="./Application_Binary_v1.img"
 
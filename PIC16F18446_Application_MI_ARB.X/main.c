@@ -41,37 +41,56 @@
 #ifdef __XC8__
 #include <xc.h>
 #endif
+
+/*
+    The Slot1 configuration links the image to run from the staging area for the slot swap install mode.
+    The Backup configuration links it for the 0xAA0 word execution image space of the back-up image layout.
+    All other configurations link it to run from the 0x1000 word execution image space.
+    The footer occupies the last 0x12 words of the image space.
+ */
+#if defined(XPRJ_Slot1)
+#define APPLICATION_IMAGE_START 0x00003000
+#define APPLICATION_IMAGE_SIZE  0x1000
+#elif defined(XPRJ_Backup)
+#define APPLICATION_IMAGE_START 0x00002000
+#define APPLICATION_IMAGE_SIZE  0xAA0
+#else
+#define APPLICATION_IMAGE_START 0x00002000
+#define APPLICATION_IMAGE_SIZE  0x1000
+#endif
+#define APPLICATION_FOOTER_START (APPLICATION_IMAGE_START + APPLICATION_IMAGE_SIZE - 0x12)
+
 volatile const uint16_t
 #ifdef __XC8__
-__at(0x2FEE)
+__at(APPLICATION_FOOTER_START)
 #endif
 applicationId __attribute__((used, section("app_id"))) = 0x0000; // EXECUTION SPACE
 
 volatile const uint32_t
 #ifdef __XC8__
-__at(0x2FF0)
+__at(APPLICATION_FOOTER_START + 0x2)
 #endif
 applicationVersion __attribute__((used, section("app_version"))) = 0x00000100;
 
 volatile const uint32_t
 #ifdef __XC8__
-__at(0x2FF4)
+__at(APPLICATION_FOOTER_START + 0x6)
 #endif
-verificationEndAddress __attribute__((used, section("crc_end_address"))) = 0x00002FFB;
+verificationEndAddress __attribute__((used, section("crc_end_address"))) = APPLICATION_FOOTER_START + 0xD;
 
 volatile const uint32_t
 #ifdef __XC8__
-__at(0x2FF8)
+__at(APPLICATION_FOOTER_START + 0xA)
 #endif
-verificationStartAddress __attribute__((used, section("crc_start_address"))) = 0x00002000;
+verificationStartAddress __attribute__((used, section("crc_start_address"))) = APPLICATION_IMAGE_START;
 
 volatile const uint32_t
 #ifdef __XC8__
-__at(0x2FFC)
+__at(APPLICATION_FOOTER_START + 0xE)
 #endif
 applicationFooter __attribute__((used, section("application_footer"))) = 0xFFFFFFFF;
 
-static flash_address_t footerSignatureLocation = 0x2FFC;
+static flash_address_t footerSignatureLocation = APPLICATION_FOOTER_START + 0xE;
 
 void BlinkLED(void)
 {
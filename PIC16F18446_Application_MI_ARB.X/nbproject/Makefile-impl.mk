@@ -31,7 +31,7 @@ DEFAULTCONF=Standalone
 CONF=${DEFAULTCONF}
 
 # All Configurations
-ALLCONFS=Standalone Combined 
+ALLCONFS=Standalone Combined Slot1 Backup 
 
 
 # build
@@ -47,6 +47,8 @@ ALLCONFS=Standalone Combined
 .clobber-impl: .clobber-pre .depcheck-impl
 	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Standalone clean
 	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Combined clean
+	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Slot1 clean
+	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Backup clean
 
 
 
@@ -54,6 +56,8 @@ ALLCONFS=Standalone Combined
 .all-impl: .all-pre .depcheck-impl
 	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Standalone build
 	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Combined build
+	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Slot1 build
+	    ${MAKE} SUBPROJECTS=${SUBPROJECTS} CONF=Backup build
 
 
 
@@ -12,3 +12,11 @@ CND_ARTIFACT_PATH_Standalone=dist/Standalone/production/PIC16F18446_Application_
 CND_ARTIFACT_DIR_Combined=dist/Combined/production
 CND_ARTIFACT_NAME_Combined=PIC16F18446_Application_MI_ARB.X.production.hex
 CND_ARTIFACT_PATH_Combined=dist/Combined/production/PIC16F18446_Application_MI_ARB.X.production.hex
+# Slot1 configuration
+CND_ARTIFACT_DIR_Slot1=dist/Slot1/production
+CND_ARTIFACT_NAME_Slot1=PIC16F18446_Application_MI_ARB.X.production.hex
+CND_ARTIFACT_PATH_Slot1=dist/Slot1/production/PIC16F18446_Application_MI_ARB.X.production.hex
+# Backup configuration
+CND_ARTIFACT_DIR_Backup=dist/Backup/production
+CND_ARTIFACT_NAME_Backup=PIC16F18446_Application_MI_ARB.X.production.hex
+CND_ARTIFACT_PATH_Backup=dist/Backup/production/PIC16F18446_Application_MI_ARB.X.production.hex
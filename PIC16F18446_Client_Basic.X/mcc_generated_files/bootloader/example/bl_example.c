@@ -89,6 +89,8 @@ void BL_Example(void)
     {
     case APPLICATION:
         BL_INDICATOR_OFF();
+        // Release the timer borrowed for the baud rate fallback before the application starts
+        FTP_Deinitialize();
         // switch the interrupt flag to handle application interrupts 
         bootloaderIsRunning = 0;
         BL_ApplicationStart();
@@ -57,7 +57,7 @@
  * Represents the minor version of the image format that is
  * understood by the bootloader core. \n
  */
-#define BL_IMAGE_FORMAT_MINOR_VERSION (0x03) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#define BL_IMAGE_FORMAT_MINOR_VERSION (0x04) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_IMAGE_FORMAT_PATCH_VERSION
@@ -125,5 +125,85 @@
  * Number of application image spaces configured.
  */
 #define BL_APPLICATION_IMAGE_COUNT (1U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_CRC32_TABLE_SIZE
+ * Selects the CRC-32 engine used for image verification. \n
+ * 0 - Bit-by-bit calculation. Smallest code size, eight shift/XOR steps per byte. \n
+ * 16 - 16-entry nibble lookup table (64 bytes of constant data), two lookups per byte. \n
+ * 256 - 256-entry byte lookup table (1 KB of constant data), one lookup per byte. Intended for larger parts. \n
+ * All options produce identical CRC values.
+ */
+#define BL_CRC32_TABLE_SIZE (16U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_LAZY_STAGING_ERASE_ENABLED
+ * Defines whether the staging area is erased page by page as the image is written instead of all at once
+ * when the bootloader is unlocked. The pages the image does not use are erased before the image state
+ * check or at the end of the transfer.
+ */
+#define BL_LAZY_STAGING_ERASE_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_FLASH_WRITE_COMPARE_ENABLED
+ * Defines whether a Flash page write first compares the page with the data to write. Identical pages are
+ * neither erased nor programmed, and blank pages are programmed without an erase.
+ */
+#define BL_FLASH_WRITE_COMPARE_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_WRITE_PAGE_COUNT
+ * Maximum number of contiguous Flash pages carried by one WRITE_FLASH block. The receive buffers grow by one
+ * page per packet buffer for every additional page. Image files must be built with blocks of at most this many
+ * pages, because the host splits the file by the advertised buffer size. The default of 1 keeps single-page
+ * image files working.
+ */
+#define BL_WRITE_PAGE_COUNT (1U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_COMPRESSED_WRITE_ENABLED
+ * Defines whether the core accepts compressed Flash data blocks. A compressed block packs the program words
+ * without their unused upper bits and replaces runs of erased words with a single token. It is decoded one
+ * page at a time into a page-sized RAM buffer. Compressed blocks were added in image format 0.4.0. Images
+ * built by pyfwimagebuilder are converted with tools/pack_image.py.
+ */
+#define BL_COMPRESSED_WRITE_ENABLED (0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_RANGE_CRC_ENABLED
+ * Defines whether the FTP answers CRC-32 requests over a host-selected range of the application image spaces.
+ * A host can then check the contents of a device without a transfer. The CRC of a range still tells the host
+ * something about the code in it, so the command is disabled by default, is only answered after an unlock block
+ * has been accepted and only covers whole pages.
+ */
+#define BL_RANGE_CRC_ENABLED (0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_RANGE_CRC_MIN_PAGE_COUNT
+ * Smallest range, in Flash pages, that a CRC-32 request may cover.
+ */
+#define BL_RANGE_CRC_MIN_PAGE_COUNT (8U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_RESUMABLE_TRANSFER_ENABLED
+ * Defines whether the core records its progress through a transfer in a reserved Flash row. When a Start Transfer
+ * command names the same image again, the staging area pages already written are kept and the host may resume
+ * from the first unwritten page. The final image verification still decides whether the transfer succeeded.
+ */
+#define BL_RESUMABLE_TRANSFER_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_TRANSFER_SESSION_ADDRESS
+ * Start of the Flash row that holds the transfer session record. The row is excluded from the
+ * project ROM ranges to keep it free.
+ */
+#define BL_TRANSFER_SESSION_ADDRESS (0x0FE0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_SESSION_CHECKPOINT_PAGES
+ * Number of contiguous staging area pages written between two checkpoints of the transfer session record.
+ * Each checkpoint programs two locations of the session row; a resumed transfer sends at most this many pages again.
+ */
+#define BL_SESSION_CHECKPOINT_PAGES (8U)
 
 #endif // BL_BOOT_CONFIG_H
@@ -78,28 +78,200 @@ static bool bootloaderCoreUnlocked = false;
 typedef void (*app_t)(void);
 #endif
 
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+#if BL_STAGING_IMAGE_ID != 1
+#error "BL_SLOT_SWAP_ENABLED requires the staging area to follow the execution image space"
+#endif
+/**
+ * In slot swap mode each image is linked for the slot it is stored in. The host addresses the download area
+ * directly and delta blocks copy from the image that is running.
+ */
+#define DOWNLOAD_AREA_START     BL_ApplicationStartAddressGet(BL_ApplicationStagingIdGet())
+#define DOWNLOAD_ADDRESS_OFFSET ((flash_address_t) 0U)
+#define RUNNING_IMAGE_START     BL_ApplicationStartAddressGet(BL_ApplicationActiveIdGet())
+#else
+/* This mathematical corelation is consistent as long as the execution image is located at the lower addresses and all image spaces are the same size. */
+#define DOWNLOAD_AREA_START     ((flash_address_t) BL_STAGING_IMAGE_START)
+#define DOWNLOAD_ADDRESS_OFFSET ((flash_address_t) (BL_STAGING_IMAGE_START - BL_APPLICATION_START_ADDRESS))
+#define RUNNING_IMAGE_START     ((flash_address_t) BL_APPLICATION_START_ADDRESS)
+#endif
+#define DOWNLOAD_AREA_END       (DOWNLOAD_AREA_START + (flash_address_t) (BL_STAGING_IMAGE_END - BL_STAGING_IMAGE_START))
+/* First address of the image as the host sends it */
+#define DOWNLOAD_HOST_START     (DOWNLOAD_AREA_START - DOWNLOAD_ADDRESS_OFFSET)
+
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+#define STAGING_PAGE_COUNT      ((uint16_t) ((((uint32_t) BL_STAGING_IMAGE_END + 1U) - (uint32_t) BL_STAGING_IMAGE_START) / (uint32_t) PROGMEM_PAGE_SIZE))
+#define STAGING_BITMAP_SIZE     ((STAGING_PAGE_COUNT + 7U) / 8U)
+
+/* One bit per staging area page, set once the page has been erased or programmed since the last unlock */
+static uint8_t stagingPageErased[STAGING_BITMAP_SIZE];
+#endif
+
+#if ((BL_APPLICATION_IMAGE_COUNT > 1) && (BL_COPY_JOURNAL_ENABLED == 1)) || (BL_RESUMABLE_TRANSFER_ENABLED == 1)
+/**
+ * The transfer session and copy journal rows store their values one byte per Flash location and
+ * start with a magic value. Single locations are programmed without an erase by writing erased values to the rest of the row.
+ */
+#define RESERVED_ROWS_USED
+#if defined(PIC_ARCH) && !defined(_PIC18)
+#define ROW_ERASED_VALUE        ((flash_data_t) 0x3FFFU)
+#else
+#define ROW_ERASED_VALUE        ((flash_data_t) 0xFFU)
+#endif
+
+static void ReservedRowErasedFill(flash_data_t * rowData);
+static nvm_status_t ReservedRowProgram(flash_address_t address, flash_data_t * rowData, uint16_t keyOffset);
+static void ReservedRowErase(flash_address_t address, uint16_t keyOffset);
+static uint32_t ReservedRowUint32Get(flash_address_t address);
+#endif
+
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_VERIFIED_MARKER_ENABLED == 1)
+/**
+ * Layout of the verified marker in Data EEPROM. Every EEPROM byte is erased by its own write, so the marker is
+ * updated in place without touching program Flash. The magic byte is written last and cleared first, so a
+ * marker torn by a reset is never trusted.
+ */
+#define MARKER_MAGIC            ((eeprom_data_t) 0xA5U)
+#define MARKER_ERASED_VALUE     ((eeprom_data_t) 0xFFU)
+#define MARKER_MAGIC_OFFSET     (0U)
+#define MARKER_CRC_OFFSET       (1U)
+#define MARKER_VERSION_OFFSET   (MARKER_CRC_OFFSET + HASH_DATA_SIZE)
+#define MARKER_BOOT_COUNT_OFFSET (MARKER_VERSION_OFFSET + VERSION_DATA_SIZE)
+#define MARKER_SIZE             (MARKER_BOOT_COUNT_OFFSET + 1U)
+
+#if (BL_VERIFIED_MARKER_ADDRESS < EEPROM_START_ADDRESS) || ((BL_VERIFIED_MARKER_ADDRESS + MARKER_SIZE) > (EEPROM_START_ADDRESS + EEPROM_SIZE))
+#error "BL_VERIFIED_MARKER_ADDRESS must leave room for the verified marker inside Data EEPROM"
+#endif
+#if BL_FULL_VERIFY_INTERVAL > 0xFFU
+#error "BL_FULL_VERIFY_INTERVAL exceeds the number of boots the verified marker can count"
+#endif
+
+static bool VerifiedMarkerMatch(const bl_footer_data_t * footerData, uint8_t * bootCount);
+static void VerifiedMarkerWrite(const bl_footer_data_t * footerData);
+static void VerifiedMarkerTallyAdd(uint8_t bootCount);
+static void VerifiedMarkerErase(void);
+static void MarkerByteWrite(uint8_t offset, eeprom_data_t data);
+static uint32_t MarkerUint32Get(uint8_t offset);
+#endif
+
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+/**
+ * Layout of the transfer session row. The header holds the footer CRC and version of the image being received,
+ * one byte per Flash location. Each checkpoint after it is a count of contiguous page groups followed by its
+ * complement, so a pair torn by a reset is ignored. Checkpoints are programmed one at a time without an erase.
+ */
+#define SESSION_MAGIC           ((flash_data_t) 0x5AU)
+#define SESSION_MAGIC_OFFSET    (0U)
+#define SESSION_CRC_OFFSET      (1U)
+#define SESSION_VERSION_OFFSET  (SESSION_CRC_OFFSET + 4U)
+#define SESSION_CHECKPOINT_OFFSET (SESSION_VERSION_OFFSET + 4U)
+#define SESSION_CHECKPOINT_COUNT ((PROGMEM_PAGE_SIZE - SESSION_CHECKPOINT_OFFSET) / 2U)
+#define SESSION_GROUP_SIZE      ((flash_address_t) BL_SESSION_CHECKPOINT_PAGES * PROGMEM_PAGE_SIZE)
+#define SESSION_GROUP_COUNT     ((uint16_t) ((((uint32_t) BL_STAGING_IMAGE_END + 1U) - (uint32_t) BL_STAGING_IMAGE_START) / (uint32_t) SESSION_GROUP_SIZE))
+
+#if (((BL_STAGING_IMAGE_END + 1) - BL_STAGING_IMAGE_START) / (PROGMEM_PAGE_SIZE * BL_SESSION_CHECKPOINT_PAGES)) > 255
+#error "BL_SESSION_CHECKPOINT_PAGES is too small to count the staging area page groups in one byte"
+#endif
+
+static bool isSessionIdentitySet = false;
+static bool isSessionResumeArmed = false;
+static uint32_t sessionImageVersion = 0U;
+static uint32_t sessionImageCrc = 0U;
+static uint16_t sessionPageCount = 0U;
+static uint8_t sessionCheckpointSlot = 0U;
+
+static flash_address_t TransferSessionBegin(void);
+static void TransferSessionProgress(flash_address_t pageAddress);
+static bool TransferSessionIdentityGet(uint32_t * imageVersion, uint32_t * imageCrc);
+static uint8_t TransferSessionCheckpointGet(uint8_t * freeSlot);
+static void TransferSessionHeaderWrite(void);
+static void TransferSessionCheckpointWrite(uint8_t groupCount);
+static void TransferSessionErase(void);
+#endif
+
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_COPY_JOURNAL_ENABLED == 1)
+/**
+ * Layout of the copy journal row. The header names the source and destination image spaces and the footer CRC
+ * and version of the image being copied. Mark N is programmed once page group N has been copied; a location
+ * that does not read back as a complete mark counts as not done.
+ */
+#define JOURNAL_MAGIC           ((flash_data_t) 0xC3U)
+#define JOURNAL_MARK            ((flash_data_t) 0x00U)
+#define JOURNAL_MAGIC_OFFSET    (0U)
+#define JOURNAL_SOURCE_OFFSET   (1U)
+#define JOURNAL_DESTINATION_OFFSET (2U)
+#define JOURNAL_CRC_OFFSET      (3U)
+#define JOURNAL_VERSION_OFFSET  (JOURNAL_CRC_OFFSET + HASH_DATA_SIZE)
+#define JOURNAL_MARK_OFFSET     (JOURNAL_VERSION_OFFSET + VERSION_DATA_SIZE)
+#define JOURNAL_MARK_COUNT      (PROGMEM_PAGE_SIZE - JOURNAL_MARK_OFFSET)
+#define JOURNAL_GROUP_SIZE      ((uint32_t) BL_COPY_JOURNAL_PAGES * PROGMEM_PAGE_SIZE)
+
+#if (BL_IMAGE_PARTITION_SIZE / (PROGMEM_PAGE_SIZE * BL_COPY_JOURNAL_PAGES)) > JOURNAL_MARK_COUNT
+#error "BL_COPY_JOURNAL_PAGES is too small for the copy journal row to mark every page group"
+#endif
+
+static uint32_t CopyJournalBegin(uint8_t srcImageId, uint8_t destImageId, const bl_footer_data_t * footerData);
+static void CopyJournalMark(uint8_t groupIndex);
+#endif
+
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_DELTA_WRITE_ENABLED == 1) && (BL_COMPRESSED_WRITE_ENABLED != 1)
+#error "BL_DELTA_WRITE_ENABLED requires BL_COMPRESSED_WRITE_ENABLED"
+#endif
+
+#if BL_COMPRESSED_WRITE_ENABLED == 1
+/**
+ * Compressed block stream format. Literal words are packed at the width of a program word, so the two
+ * unused bits of each PIC16 word are not transferred.
+ */
+#if defined(PIC_ARCH) && !defined(_PIC18)
+#define COMPRESSED_WORD_BITS    (14U)
+#define COMPRESSED_ERASED_WORD  ((flash_data_t) 0x3FFFU)
+#else
+#define COMPRESSED_WORD_BITS    (8U)
+#define COMPRESSED_ERASED_WORD  ((flash_data_t) 0xFFU)
+#endif
+#define COMPRESSED_WORD_MASK    ((uint16_t) ((1UL << COMPRESSED_WORD_BITS) - 1UL))
+#define COMPRESSED_RUN_ERASED   (0x80U)
+#define COMPRESSED_RUN_MASK     (0x7FU)
+
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_DELTA_WRITE_ENABLED == 1)
+#define DELTA_RUN_COPY          (0x80U)
+#define DELTA_SOURCE_OFFSET_SIZE (2U)
+#endif
+
+/* cppcheck-suppress misra-c2012-8.9; The page buffer will not be placed on the stack. */
+static flash_data_t decodedPage[PROGMEM_PAGE_SIZE];
+
+static bl_result_t CompressedBlockWrite(flash_address_t pageAddress, const uint8_t * stream, uint16_t streamLength, bool isDeltaStream);
+#endif
+
 static bl_result_t BootloaderProcessorUnlock(uint8_t * bufferPtr);
+static bl_result_t StagingPageWrite(flash_address_t pageAddress, flash_data_t * pageData);
 static void DownloadAreaErase(uint32_t startAddress, uint16_t pageEraseUnlockKey);
+static nvm_status_t DownloadPageErase(flash_address_t address, uint16_t pageEraseUnlockKey);
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+static bool StagingPageIsErased(flash_address_t address);
+static void StagingPageErasedSet(flash_address_t address);
+#endif
 
-/* cppcheck-suppress misra-c2012-2.7; This rule will not be followed to aid in new feature support in the future. */
 bl_result_t BL_BootCommandProcess(uint8_t * bootDataPtr, uint16_t bufferLength)
 {
     bl_result_t bootCommandStatus = BL_ERROR_UNKNOWN_COMMAND;
 
-    // Copy the data buffer into a defined packet structure
-    bl_command_header_t commandHeader;
-    (void) memcpy(&commandHeader, (void *) & bootDataPtr[BL_BLOCK_HEADER_SIZE] , sizeof (bl_command_header_t));
-    bl_block_header_t blockHeader;
-    (void) memcpy(&blockHeader, (void *) bootDataPtr, BL_BLOCK_HEADER_SIZE);
+    // Parse the headers in place; the receive buffer is not modified until the command completes
+    /* cppcheck-suppress misra-c2012-11.3 */
+    const bl_command_header_t * commandHeader = (const bl_command_header_t *) & bootDataPtr[BL_BLOCK_HEADER_SIZE];
+    /* cppcheck-suppress misra-c2012-11.3 */
+    const bl_block_header_t * blockHeader = (const bl_block_header_t *) bootDataPtr;
 
 #ifdef PIC_ARCH
-    coreMemoryKeys.eraseUnlockKey = commandHeader.pageEraseUnlockKey;
-    coreMemoryKeys.byteWordWriteUnlockKey = commandHeader.byteWriteUnlockKey;
-    coreMemoryKeys.rowWriteUnlockKey = commandHeader.pageWriteUnlockKey;
-    coreMemoryKeys.readUnlockKey = commandHeader.pageReadUnlockKey;
+    coreMemoryKeys.eraseUnlockKey = commandHeader->pageEraseUnlockKey;
+    coreMemoryKeys.byteWordWriteUnlockKey = commandHeader->byteWriteUnlockKey;
+    coreMemoryKeys.rowWriteUnlockKey = commandHeader->pageWriteUnlockKey;
+    coreMemoryKeys.readUnlockKey = commandHeader->pageReadUnlockKey;
 #endif
     // Switch on the bootloader command and execute the logic needed
-    switch (blockHeader.blockType)
+    switch (blockHeader->blockType)
     {
     case UNLOCK_BOOTLOADER:
         bootCommandStatus = BootloaderProcessorUnlock(bootDataPtr);
@@ -112,23 +284,77 @@ bl_result_t BL_BootCommandProcess(uint8_t * bootDataPtr, uint16_t bufferLength)
             BL_MemoryUnlockKeysInit(coreMemoryKeys);
 #endif
 
-            // Calculate the offset needed for the download location
-            // This mathematical corelation is consistent as long as the execution image is located at the lower addresses and all image spaces are the same size.
-            flash_address_t stagingAreaOffset = (flash_address_t) (BL_STAGING_IMAGE_START - BL_APPLICATION_START_ADDRESS);
+            // Calculate the download location of the host address
+            flash_address_t pageAddress = (flash_address_t) (commandHeader->startAddress + DOWNLOAD_ADDRESS_OFFSET);
+            // The block length counts every byte of the block, including both headers
+            uint16_t writeByteCount = (uint16_t) (blockHeader->blockLength - (BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE));
+            uint16_t pageCount = writeByteCount / BL_PAGE_BYTE_LENGTH;
 
-            if ((FLASH_PageOffsetGet((flash_address_t) (commandHeader.startAddress + stagingAreaOffset)) == (flash_address_t) 0)
+            if ((pageCount == 0U) || (pageCount > BL_WRITE_PAGE_COUNT) || ((writeByteCount % BL_PAGE_BYTE_LENGTH) != 0U))
+            {
+                bootCommandStatus = BL_ERROR_COMMAND_PROCESSING;
+            }
+            else if ((FLASH_PageOffsetGet(pageAddress) == (flash_address_t) 0)
                     /* cppcheck-suppress misra-c2012-7.2; This rule cannot be followed due to assembly syntax requirements. */
-                    && (flash_address_t) (commandHeader.startAddress + stagingAreaOffset) >= (flash_address_t) BL_STAGING_IMAGE_START)
+                    && (pageAddress >= DOWNLOAD_AREA_START)
+                    && ((pageAddress + ((flash_address_t) pageCount * PROGMEM_PAGE_SIZE) - 1U) <= DOWNLOAD_AREA_END))
             {
-                // Call the abstracted write function
-                bl_mem_result_t memoryStatus = BL_FlashWrite(
-                                                             (flash_address_t) commandHeader.startAddress + stagingAreaOffset,
-                                                             /* cppcheck-suppress misra-c2012-11.3 */
-                                                             (flash_data_t *) & (bootDataPtr[BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE]),
-                                                             PROGMEM_PAGE_SIZE
-                                                             );
+                bootCommandStatus = BL_PASS;
+                for (uint16_t pageIndex = 0U; (pageIndex < pageCount) && (bootCommandStatus == BL_PASS); pageIndex++)
+                {
+                    bootCommandStatus = StagingPageWrite(
+                                                         pageAddress,
+                                                         /* cppcheck-suppress misra-c2012-11.3 */
+                                                         (flash_data_t *) & (bootDataPtr[BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE + (pageIndex * BL_PAGE_BYTE_LENGTH)])
+                                                         );
+                    pageAddress += PROGMEM_PAGE_SIZE;
+                }
+            }
+            else
+            {
+                bootCommandStatus = BL_ERROR_ADDRESS_OUT_OF_RANGE;
+            }
+#ifdef PIC_ARCH
+            // Erase keys before proceeding
+            BL_MemoryUnlockKeysClear();
+#endif
+        }
+        break;
 
-                bootCommandStatus = (memoryStatus == BL_MEM_PASS) ? BL_PASS : BL_ERROR_COMMAND_PROCESSING;
+#if BL_COMPRESSED_WRITE_ENABLED == 1
+    case WRITE_FLASH_COMPRESSED:
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_DELTA_WRITE_ENABLED == 1)
+    case WRITE_FLASH_DELTA:
+#endif
+        if (bootloaderCoreUnlocked)
+        {
+#ifdef PIC_ARCH
+            // Provide memory unlock/lock keys to the memory layer
+            BL_MemoryUnlockKeysInit(coreMemoryKeys);
+#endif
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_DELTA_WRITE_ENABLED == 1)
+            bool isDeltaStream = (blockHeader->blockType == WRITE_FLASH_DELTA);
+#else
+            bool isDeltaStream = false;
+#endif
+            flash_address_t pageAddress = (flash_address_t) (commandHeader->startAddress + DOWNLOAD_ADDRESS_OFFSET);
+
+            // The stream is decoded straight from the receive buffer, so it must end inside the received data
+            if ((blockHeader->blockLength < (BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE))
+                    || (blockHeader->blockLength > bufferLength))
+            {
+                bootCommandStatus = BL_ERROR_COMMAND_PROCESSING;
+            }
+            else if ((FLASH_PageOffsetGet(pageAddress) == (flash_address_t) 0)
+                    /* cppcheck-suppress misra-c2012-7.2; This rule cannot be followed due to assembly syntax requirements. */
+                    && (pageAddress >= DOWNLOAD_AREA_START))
+            {
+                bootCommandStatus = CompressedBlockWrite(
+                                                         pageAddress,
+                                                         & (bootDataPtr[BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE]),
+                                                         (uint16_t) (blockHeader->blockLength - (BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE)),
+                                                         isDeltaStream
+                                                         );
             }
             else
             {
@@ -140,6 +366,7 @@ bl_result_t BL_BootCommandProcess(uint8_t * bootDataPtr, uint16_t bufferLength)
 #endif
         }
         break;
+#endif
 
 #if defined(BL_EEPROM_WRITE_ENABLED)
     case WRITE_EEPROM:
@@ -149,12 +376,12 @@ bl_result_t BL_BootCommandProcess(uint8_t * bootDataPtr, uint16_t bufferLength)
             // Provide memory unlock/lock keys to the memory layer
             BL_MemoryUnlockKeysInit(coreMemoryKeys);
 #endif
-            if (FLASH_PageOffsetGet((eeprom_address_t) commandHeader.startAddress) == (eeprom_address_t) 0)
+            if (FLASH_PageOffsetGet((eeprom_address_t) commandHeader->startAddress) == (eeprom_address_t) 0)
             {
                 bl_mem_result_t memoryStatus = BL_EEPROMWrite(
-                                                              (eeprom_address_t) commandHeader.startAddress,
+                                                              (eeprom_address_t) commandHeader->startAddress,
                                                               (eeprom_data_t *) & (bootDataPtr[BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE]),
-                                                              (blockHeader.blockLength - ((BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE)  - 2U))
+                                                              (blockHeader->blockLength - ((BL_COMMAND_HEADER_SIZE + BL_BLOCK_HEADER_SIZE)  - 2U))
                                                               );
 
                 bootCommandStatus = (memoryStatus == BL_MEM_PASS) ? BL_PASS : BL_ERROR_COMMAND_PROCESSING;
@@ -183,13 +410,31 @@ void BL_ApplicationStart(void)
 #if defined(AVR_ARCH)
     /* cppcheck-suppress misra-c2012-7.2;
     This rule cannot be followed due to assembly syntax requirements. */
-    app_t app = (app_t) ((uint64_t) BL_APPLICATION_START_ADDRESS / sizeof (app_t));
+    app_t app = (app_t) ((uint64_t) RUNNING_IMAGE_START / sizeof (app_t));
     app();
 #elif defined(_PIC18)
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+    if (BL_ApplicationActiveIdGet() == (uint8_t) BL_STAGING_IMAGE_ID)
+    {
+        STKPTR = 0x00U;
+        BSR = 0x00U;
+        asm("goto " ___mkstr(BL_STAGING_IMAGE_START));
+    }
+#endif
     STKPTR = 0x00U;
     BSR = 0x00U;
     asm("goto " ___mkstr(BL_APPLICATION_START_ADDRESS));
 #elif defined(PIC_ARCH) && !defined(_PIC18)
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+    // The image in the staging area was linked to run from there
+    if (BL_ApplicationActiveIdGet() == (uint8_t) BL_STAGING_IMAGE_ID)
+    {
+        STKPTR = 0x1FU;
+        BSR = 0U;
+        asm("pagesel " ___mkstr(BL_STAGING_IMAGE_START));
+        asm("goto  " ___mkstr(BL_STAGING_IMAGE_START));
+    }
+#endif
     STKPTR = 0x1FU;
     BSR = 0U;
     asm("pagesel " ___mkstr(BL_APPLICATION_START_ADDRESS));
@@ -203,10 +448,143 @@ bl_result_t BL_Initialize(void)
 
     // Prevent the core memory functions from executing until the metadata has been validated
     bootloaderCoreUnlocked = false;
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+    // A transfer is only resumed when the host names its image again
+    isSessionIdentitySet = false;
+    isSessionResumeArmed = false;
+#endif
 
     return initResult;
 }
 
+static bl_result_t StagingPageWrite(flash_address_t pageAddress, flash_data_t * pageData)
+{
+    bl_result_t pageStatus = BL_ERROR_COMMAND_PROCESSING;
+
+    // Call the abstracted write function
+    bl_mem_result_t memoryStatus = BL_FlashWrite(pageAddress, pageData, PROGMEM_PAGE_SIZE);
+
+    if (memoryStatus == BL_MEM_PASS)
+    {
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+        // BL_FlashWrite erases the page before programming it
+        StagingPageErasedSet(pageAddress);
+#endif
+        // Fold the row into the running staging CRC so the image state check does not rescan the partition
+        BL_StagingCrcUpdate(pageAddress, (flash_address_t) PROGMEM_PAGE_SIZE);
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+        TransferSessionProgress(pageAddress);
+#endif
+        pageStatus = BL_PASS;
+    }
+    return pageStatus;
+}
+
+#if BL_COMPRESSED_WRITE_ENABLED == 1
+static bl_result_t CompressedBlockWrite(flash_address_t pageAddress, const uint8_t * stream, uint16_t streamLength, bool isDeltaStream)
+{
+    bl_result_t decodeStatus = (streamLength == 0U) ? BL_ERROR_COMMAND_PROCESSING : BL_PASS;
+    uint16_t streamIndex = 0U;
+    uint8_t pageWordCount = 0U;
+
+    while ((streamIndex < streamLength) && (decodeStatus == BL_PASS))
+    {
+        uint8_t token = stream[streamIndex];
+        uint8_t runLength = (uint8_t) ((token & COMPRESSED_RUN_MASK) + 1U);
+        // Each literal run starts on a byte boundary, so the bit buffer never carries over between tokens
+        uint32_t bitBuffer = 0UL;
+        uint8_t bitCount = 0U;
+
+        streamIndex++;
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_DELTA_WRITE_ENABLED == 1)
+        flash_address_t sourceAddress = RUNNING_IMAGE_START;
+
+        if (isDeltaStream && ((token & DELTA_RUN_COPY) != 0U))
+        {
+            if ((streamIndex + DELTA_SOURCE_OFFSET_SIZE) > streamLength)
+            {
+                decodeStatus = BL_ERROR_COMMAND_PROCESSING;
+            }
+            else
+            {
+                uint16_t sourceOffset = (uint16_t) ((uint16_t) stream[streamIndex] | ((uint16_t) stream[streamIndex + 1U] << 8U));
+
+                streamIndex += DELTA_SOURCE_OFFSET_SIZE;
+                // The copied words must lie inside the execution image space
+                if (((uint32_t) sourceOffset + runLength) > (uint32_t) BL_IMAGE_PARTITION_SIZE)
+                {
+                    decodeStatus = BL_ERROR_ADDRESS_OUT_OF_RANGE;
+                }
+                sourceAddress += (flash_address_t) sourceOffset;
+            }
+        }
+#else
+        (void) isDeltaStream;
+#endif
+        while ((runLength > 0U) && (decodeStatus == BL_PASS))
+        {
+            flash_data_t word = COMPRESSED_ERASED_WORD;
+
+            if ((token & COMPRESSED_RUN_ERASED) == 0U)
+            {
+                while ((bitCount < COMPRESSED_WORD_BITS) && (streamIndex < streamLength))
+                {
+                    bitBuffer |= ((uint32_t) stream[streamIndex] << bitCount);
+                    bitCount += 8U;
+                    streamIndex++;
+                }
+                if (bitCount < COMPRESSED_WORD_BITS)
+                {
+                    // The stream ended in the middle of a literal word
+                    decodeStatus = BL_ERROR_COMMAND_PROCESSING;
+                }
+                word = (flash_data_t) ((uint16_t) bitBuffer & COMPRESSED_WORD_MASK);
+                bitBuffer >>= COMPRESSED_WORD_BITS;
+                bitCount -= COMPRESSED_WORD_BITS;
+            }
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_DELTA_WRITE_ENABLED == 1)
+            else if (isDeltaStream)
+            {
+                word = FLASH_Read(sourceAddress);
+                sourceAddress++;
+            }
+            else
+            {
+                // Erased run; the word keeps its erased value
+            }
+#endif
+
+            if (decodeStatus == BL_PASS)
+            {
+                decodedPage[pageWordCount] = word;
+                pageWordCount++;
+                if (pageWordCount == (uint8_t) PROGMEM_PAGE_SIZE)
+                {
+                    if ((pageAddress + PROGMEM_PAGE_SIZE - 1U) > DOWNLOAD_AREA_END)
+                    {
+                        decodeStatus = BL_ERROR_ADDRESS_OUT_OF_RANGE;
+                    }
+                    else
+                    {
+                        decodeStatus = StagingPageWrite(pageAddress, decodedPage);
+                    }
+                    pageAddress += PROGMEM_PAGE_SIZE;
+                    pageWordCount = 0U;
+                }
+            }
+            runLength--;
+        }
+    }
+
+    // A block must decode to whole pages
+    if ((decodeStatus == BL_PASS) && (pageWordCount != 0U))
+    {
+        decodeStatus = BL_ERROR_COMMAND_PROCESSING;
+    }
+    return decodeStatus;
+}
+#endif
+
 static bl_result_t BootloaderProcessorUnlock(uint8_t * bufferPtr)
 {
     bl_result_t commandStatus = BL_FAIL;
@@ -262,15 +640,17 @@ static bl_result_t BootloaderProcessorUnlock(uint8_t * bufferPtr)
     {
         commandStatus = BL_ERROR_VERIFICATION_FAIL;
     }
-    // Read and compare write size
-    if (metadataPacket.maxPayloadSize != BL_WRITE_BYTE_LENGTH)
+    // Read and compare write size; the file may use any whole number of pages per block that fits the buffer
+    if ((metadataPacket.maxPayloadSize == 0U)
+            || (metadataPacket.maxPayloadSize > BL_WRITE_BYTE_LENGTH)
+            || ((metadataPacket.maxPayloadSize % BL_PAGE_BYTE_LENGTH) != 0U))
     {
         commandStatus = BL_ERROR_VERIFICATION_FAIL;
     }
     // Compare the given start of app to the APPLICATION_START_ADDRESS and handle
     /* cppcheck-suppress misra-c2012-7.2;
     This rule cannot be followed due to assembly syntax requirements. */
-    if (metadataPacket.commandHeader.startAddress != (uint32_t) BL_APPLICATION_START_ADDRESS)
+    if (metadataPacket.commandHeader.startAddress != (uint32_t) DOWNLOAD_HOST_START)
     {
         commandStatus = BL_ERROR_VERIFICATION_FAIL;
     }
@@ -333,10 +713,46 @@ static bl_result_t BootloaderProcessorUnlock(uint8_t * bufferPtr)
     {
         bootloaderCoreUnlocked = true;
         commandStatus = BL_PASS;
+#ifdef PIC_ARCH
+        // The command header of an unlock block follows the metadata, so the keys parsed from the start of the block are not valid
+        coreMemoryKeys.eraseUnlockKey = metadataPacket.commandHeader.pageEraseUnlockKey;
+        coreMemoryKeys.byteWordWriteUnlockKey = metadataPacket.commandHeader.byteWriteUnlockKey;
+        coreMemoryKeys.rowWriteUnlockKey = metadataPacket.commandHeader.pageWriteUnlockKey;
+        coreMemoryKeys.readUnlockKey = metadataPacket.commandHeader.pageReadUnlockKey;
+#endif
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+        // Pages recorded by an interrupted transfer of the same image are kept; everything after them is erased
+        flash_address_t keepEndAddress = TransferSessionBegin();
+#else
+        flash_address_t keepEndAddress = DOWNLOAD_AREA_START;
+#endif
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+        // Only the last page is erased up front so that a stale image in the staging area stops validating right away.
+        // Every other page is erased when it is first written or by BL_StagingAreaFinalize.
+        (void) memset(stagingPageErased, 0, sizeof (stagingPageErased));
+        for (flash_address_t address = DOWNLOAD_AREA_START; address < keepEndAddress; address += PROGMEM_PAGE_SIZE)
+        {
+            StagingPageErasedSet(address);
+        }
+        if ((StagingPageIsErased(FLASH_PageAddressGet(DOWNLOAD_AREA_END)) == false)
+                && (DownloadPageErase(FLASH_PageAddressGet(DOWNLOAD_AREA_END), metadataPacket.commandHeader.pageEraseUnlockKey) == NVM_OK))
+        {
+            StagingPageErasedSet(FLASH_PageAddressGet(DOWNLOAD_AREA_END));
+        }
+#else
         DownloadAreaErase(
-                        BL_STAGING_IMAGE_START,
+                        (uint32_t) keepEndAddress,
                         metadataPacket.commandHeader.pageEraseUnlockKey
                         );
+#endif
+        BL_StagingCrcReset();
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+        if (keepEndAddress > DOWNLOAD_AREA_START)
+        {
+            // The kept pages are read back into the running CRC when the next page follows them
+            BL_StagingCrcUpdate(DOWNLOAD_AREA_START, keepEndAddress - DOWNLOAD_AREA_START);
+        }
+#endif
     }
 
     return commandStatus;
@@ -345,42 +761,303 @@ static bl_result_t BootloaderProcessorUnlock(uint8_t * bufferPtr)
 /* cppcheck-suppress misra-c2012-2.7 */
 static void DownloadAreaErase(uint32_t startAddress, uint16_t pageEraseUnlockKey)
 {
-    nvm_status_t errorStatus;
-
     flash_address_t address;
     address = (flash_address_t) startAddress;
 
+    while (address < DOWNLOAD_AREA_END)
+    {
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+        // Skip the pages that were already erased or programmed during this transfer
+        if (StagingPageIsErased(address) == false)
+#endif
+        {
+            if (DownloadPageErase(address, pageEraseUnlockKey) != NVM_OK)
+            {
+                break;
+            }
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+            StagingPageErasedSet(address);
+#endif
+        }
+        address += PROGMEM_PAGE_SIZE;
+    }
+}
+
+/* cppcheck-suppress misra-c2012-2.7 */
+static nvm_status_t DownloadPageErase(flash_address_t address, uint16_t pageEraseUnlockKey)
+{
+    nvm_status_t errorStatus;
+
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_FOOTER_CACHE_ENABLED == 1)
+    BL_ApplicationFooterCacheInvalidate(address);
+#endif
 #ifdef PIC_ARCH
-    uint16_t unlockKey = pageEraseUnlockKey;
+    NVM_UnlockKeySet(pageEraseUnlockKey);
 #endif
-    while (address < BL_STAGING_IMAGE_END)
+    errorStatus = FLASH_PageErase(address);
+#ifdef PIC_ARCH
+    while(NVM_IsBusy() == true)
     {
+            
+    }
+#else 
+    while(FLASH_IsBusy() == true)
+    {
+            
+    }
+#endif
 #ifdef PIC_ARCH
-        NVM_UnlockKeySet(unlockKey);
+    NVM_UnlockKeyClear();
+#endif
+    return errorStatus;
+}
+
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+static bool StagingPageIsErased(flash_address_t address)
+{
+    uint16_t pageIndex = (uint16_t) ((address - DOWNLOAD_AREA_START) / PROGMEM_PAGE_SIZE);
+
+    return ((stagingPageErased[pageIndex >> 3U] & (uint8_t) (1U << (pageIndex & 0x07U))) != 0U);
+}
+
+static void StagingPageErasedSet(flash_address_t address)
+{
+    uint16_t pageIndex = (uint16_t) ((address - DOWNLOAD_AREA_START) / PROGMEM_PAGE_SIZE);
+
+    if (pageIndex < STAGING_PAGE_COUNT)
+    {
+        stagingPageErased[pageIndex >> 3U] |= (uint8_t) (1U << (pageIndex & 0x07U));
+    }
+}
+
+bl_result_t BL_StagingAreaFinalize(void)
+{
+    bl_result_t finalizeStatus = BL_BUSY;
+
+    while (finalizeStatus == BL_BUSY)
+    {
+        finalizeStatus = BL_StagingAreaFinalizeTask();
+    }
+    return finalizeStatus;
+}
+
+#if BL_RANGE_CRC_ENABLED == 1
+bool BL_CoreUnlockStatusGet(void)
+{
+    return bootloaderCoreUnlocked;
+}
 #endif
-        errorStatus = FLASH_PageErase(address);
+
+bl_result_t BL_StagingAreaFinalizeTask(void)
+{
+    bl_result_t finalizeStatus = BL_PASS;
+
+    // Nothing to erase unless a transfer has unlocked the core
+    if (bootloaderCoreUnlocked == true)
+    {
 #ifdef PIC_ARCH
-        while(NVM_IsBusy() == true)
+        // Reuse the keys supplied with the most recent command block
+        BL_MemoryUnlockKeysInit(coreMemoryKeys);
+#endif
+        // Find the next page that was neither erased nor programmed
+        flash_address_t address = DOWNLOAD_AREA_START;
+        while ((address < DOWNLOAD_AREA_END) && (StagingPageIsErased(address) == true))
         {
-            
+            address += PROGMEM_PAGE_SIZE;
         }
-#else 
-        while(FLASH_IsBusy() == true)
+
+        if (address < DOWNLOAD_AREA_END)
         {
-            
+            // Erase one page per call. The staging CRC treats a recorded page as blank without reading it,
+            // so a page is only recorded once its erase has completed.
+            if (BL_FlashPageErase(address) == BL_MEM_PASS)
+            {
+                StagingPageErasedSet(address);
+                finalizeStatus = BL_BUSY;
+            }
+            else
+            {
+                finalizeStatus = BL_FAIL;
+            }
         }
-#endif
 #ifdef PIC_ARCH
-        NVM_UnlockKeyClear();
+        BL_MemoryUnlockKeysClear();
 #endif
-        if (errorStatus != NVM_OK)
+    }
+    return finalizeStatus;
+}
+#endif
+
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+void BL_TransferSessionOpen(uint32_t imageVersion, uint32_t imageCrc)
+{
+    uint32_t storedVersion = 0U;
+    uint32_t storedCrc = 0U;
+    uint8_t freeSlot = 0U;
+
+    sessionImageVersion = imageVersion;
+    sessionImageCrc = imageCrc;
+    isSessionIdentitySet = true;
+    // Only a record of the same image that reached its first checkpoint is worth resuming
+    isSessionResumeArmed = ((TransferSessionIdentityGet(&storedVersion, &storedCrc) == true)
+            && (storedVersion == imageVersion)
+            && (storedCrc == imageCrc)
+            && (TransferSessionCheckpointGet(&freeSlot) > 0U));
+}
+
+bool BL_TransferSessionGet(uint32_t * imageVersion, uint32_t * imageCrc, uint32_t * resumeAddress)
+{
+    uint8_t freeSlot = 0U;
+    bool isRecorded = TransferSessionIdentityGet(imageVersion, imageCrc);
+
+    if (isRecorded == true)
+    {
+        // The resume address is given as the host addresses the download area
+        /* cppcheck-suppress misra-c2012-7.2; This rule cannot be followed due to assembly syntax requirements. */
+        *resumeAddress = (uint32_t) DOWNLOAD_HOST_START + ((uint32_t) TransferSessionCheckpointGet(&freeSlot) * (uint32_t) SESSION_GROUP_SIZE);
+    }
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+    else
+    {
+        // Tells the host which of its per-slot images to send
+        *resumeAddress = (uint32_t) DOWNLOAD_HOST_START;
+    }
+#endif
+    return isRecorded;
+}
+
+void BL_TransferSessionClose(void)
+{
+    // The erase reuses the keys of the most recent command block, so it needs an unlocked core
+    if (bootloaderCoreUnlocked == true)
+    {
+        TransferSessionErase();
+    }
+    // Pages written after this point belong to no resumable transfer
+    isSessionIdentitySet = false;
+    isSessionResumeArmed = false;
+}
+
+static flash_address_t TransferSessionBegin(void)
+{
+    flash_address_t keepEndAddress = DOWNLOAD_AREA_START;
+    uint8_t freeSlot = 0U;
+
+    sessionPageCount = 0U;
+    if (isSessionResumeArmed == true)
+    {
+        // Continue from the last checkpoint and append the next ones after it
+        sessionPageCount = (uint16_t) TransferSessionCheckpointGet(&freeSlot) * BL_SESSION_CHECKPOINT_PAGES;
+        sessionCheckpointSlot = freeSlot;
+        keepEndAddress += (flash_address_t) sessionPageCount * PROGMEM_PAGE_SIZE;
+    }
+    else if (isSessionIdentitySet == true)
+    {
+        TransferSessionHeaderWrite();
+    }
+    else
+    {
+        // Without the image identity there is nothing a later transfer could be matched against
+        TransferSessionErase();
+    }
+    // Another unlock during the same transfer starts over
+    isSessionResumeArmed = false;
+    return keepEndAddress;
+}
+
+static void TransferSessionProgress(flash_address_t pageAddress)
+{
+    // Only a page that extends the contiguous run from the start of the staging area moves the checkpoint
+    if ((isSessionIdentitySet == true)
+            && (pageAddress == (DOWNLOAD_AREA_START + ((flash_address_t) sessionPageCount * PROGMEM_PAGE_SIZE))))
+    {
+        sessionPageCount++;
+        if ((sessionPageCount % BL_SESSION_CHECKPOINT_PAGES) == 0U)
         {
-            break;
+            TransferSessionCheckpointWrite((uint8_t) (sessionPageCount / BL_SESSION_CHECKPOINT_PAGES));
         }
-        address += PROGMEM_PAGE_SIZE;
     }
 }
 
+static bool TransferSessionIdentityGet(uint32_t * imageVersion, uint32_t * imageCrc)
+{
+    bool isRecorded = false;
+    flash_address_t sessionAddress = (flash_address_t) BL_TRANSFER_SESSION_ADDRESS;
+
+    if (FLASH_Read(sessionAddress + SESSION_MAGIC_OFFSET) == SESSION_MAGIC)
+    {
+        *imageCrc = ReservedRowUint32Get(sessionAddress + SESSION_CRC_OFFSET);
+        *imageVersion = ReservedRowUint32Get(sessionAddress + SESSION_VERSION_OFFSET);
+        isRecorded = true;
+    }
+    return isRecorded;
+}
+
+static uint8_t TransferSessionCheckpointGet(uint8_t * freeSlot)
+{
+    uint8_t groupCount = 0U;
+    flash_address_t slotAddress = (flash_address_t) BL_TRANSFER_SESSION_ADDRESS + SESSION_CHECKPOINT_OFFSET;
+
+    // Checkpoints are programmed in slot order so the first blank slot ends the list
+    *freeSlot = 0U;
+    while ((*freeSlot < SESSION_CHECKPOINT_COUNT)
+            && ((FLASH_Read(slotAddress) != ROW_ERASED_VALUE) || (FLASH_Read(slotAddress + 1U) != ROW_ERASED_VALUE)))
+    {
+        uint8_t value = (uint8_t) FLASH_Read(slotAddress);
+        uint8_t complement = (uint8_t) FLASH_Read(slotAddress + 1U);
+
+        if (((uint8_t) (value ^ complement) == 0xFFU) && ((uint16_t) value <= SESSION_GROUP_COUNT))
+        {
+            groupCount = value;
+        }
+        (*freeSlot)++;
+        slotAddress += 2U;
+    }
+    return groupCount;
+}
+
+static void TransferSessionHeaderWrite(void)
+{
+    flash_data_t rowData[PROGMEM_PAGE_SIZE];
+
+    ReservedRowErasedFill(rowData);
+    rowData[SESSION_MAGIC_OFFSET] = SESSION_MAGIC;
+    for (uint8_t index = 0U; index < 4U; index++)
+    {
+        rowData[SESSION_CRC_OFFSET + index] = (flash_data_t) ((sessionImageCrc >> (8U * index)) & 0xFFU);
+        rowData[SESSION_VERSION_OFFSET + index] = (flash_data_t) ((sessionImageVersion >> (8U * index)) & 0xFFU);
+    }
+
+    TransferSessionErase();
+    (void) ReservedRowProgram((flash_address_t) BL_TRANSFER_SESSION_ADDRESS, rowData, 0x0000U);
+    sessionCheckpointSlot = 0U;
+}
+
+static void TransferSessionCheckpointWrite(uint8_t groupCount)
+{
+    flash_data_t rowData[PROGMEM_PAGE_SIZE];
+
+    // A full row is started over; a reset before the new checkpoint lands only costs the pages since the last one
+    if (sessionCheckpointSlot >= SESSION_CHECKPOINT_COUNT)
+    {
+        TransferSessionHeaderWrite();
+    }
+    // Erased values leave the programmed locations untouched, so only the next checkpoint is written
+    ReservedRowErasedFill(rowData);
+    rowData[SESSION_CHECKPOINT_OFFSET + (2U * sessionCheckpointSlot)] = (flash_data_t) groupCount;
+    rowData[SESSION_CHECKPOINT_OFFSET + (2U * sessionCheckpointSlot) + 1U] = (flash_data_t) ((uint8_t) ~groupCount);
+
+    (void) ReservedRowProgram((flash_address_t) BL_TRANSFER_SESSION_ADDRESS, rowData, 0x0000U);
+    sessionCheckpointSlot++;
+}
+
+static void TransferSessionErase(void)
+{
+    // The session row is only written while a command block or an image copy has set the complete keys
+    ReservedRowErase((flash_address_t) BL_TRANSFER_SESSION_ADDRESS, 0x0000U);
+}
+#endif
+
 #if BL_APPLICATION_IMAGE_COUNT > 1
 #ifdef PIC_ARCH
 void BL_InternalKeySet(void)
@@ -420,22 +1097,72 @@ bl_result_t BL_CopyImageAreas(uint8_t srcImageId, uint8_t destImageId)
         flash_address_t destinationAddressStart = BL_ApplicationStartAddressGet(destImageId);
         flash_address_t srcAddressStart = BL_ApplicationStartAddressGet(srcImageId);
 
+        // Only the range covered by the source footer and the footer page itself need to be copied.
+        // Footer addresses are execution addresses so they are converted into offsets within the image space.
+        bl_footer_data_t footerData;
+        uint32_t copyStartOffset = 0U;
+        uint32_t copyEndOffset = (uint32_t) BL_IMAGE_PARTITION_SIZE - 1U;
+        uint32_t footerPageOffset = (uint32_t) FLASH_PageAddressGet(BL_ApplicationFooterStartAddressGet(srcImageId)) - (uint32_t) srcAddressStart;
+        uint32_t resumeOffset = 0U;
+
+        // A footer that cannot be read leaves the whole image space to be copied
+        /* cppcheck-suppress misra-c2012-7.2; This rule cannot be followed due to assembly syntax requirements. */
+        if ((BL_ApplicationFooterRead(srcImageId, &footerData) == true)
+                && (footerData.verificationStartAddress >= (uint32_t) BL_APPLICATION_START_ADDRESS)
+                && (footerData.verificationEndAddress <= (uint32_t) BL_APPLICATION_END_ADDRESS)
+                && (footerData.verificationStartAddress <= footerData.verificationEndAddress))
+        {
+            copyStartOffset = footerData.verificationStartAddress - (uint32_t) BL_APPLICATION_START_ADDRESS;
+            copyEndOffset = footerData.verificationEndAddress - (uint32_t) BL_APPLICATION_START_ADDRESS;
+        }
+
         if (destinationAddressStart >= BL_APPLICATION_START_ADDRESS)
         {
+#if BL_VERIFIED_MARKER_ENABLED == 1
+            if (destImageId == (uint8_t) IMAGE_0)
+            {
+                // The execution image is about to change; it must be fully verified again
+                VerifiedMarkerErase();
+            }
+#endif
 #ifdef PIC_ARCH
             // Finish initializing the keys needed for the copy operation
             coreMemoryKeys.eraseUnlockKey -= BL_KEY_OPERATOR;
             coreMemoryKeys.rowWriteUnlockKey -= BL_KEY_OPERATOR;
 #endif
-            // Copy the entire length of the image area page-by-page
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+            if (destImageId == (uint8_t) BL_STAGING_IMAGE_ID)
+            {
+                // The pages recorded by the transfer session are about to be replaced
+                TransferSessionErase();
+            }
+#endif
+#if BL_COPY_JOURNAL_ENABLED == 1
+            // Page groups completed by an interrupted copy of the same image are not copied again
+            resumeOffset = CopyJournalBegin(srcImageId, destImageId, &footerData);
+#endif
+            // Walk the entire length of the image area page-by-page
             for (uint32_t byteCount = 0; byteCount < BL_IMAGE_PARTITION_SIZE; byteCount += PROGMEM_PAGE_SIZE)
             {
 #ifdef PIC_ARCH
                 // Pass the calculated keys to the memory layer
                 BL_MemoryUnlockKeysInit(coreMemoryKeys);
 #endif
-                // Perform the copy operation on the next page
-                errorStatus = BL_FlashCopy(srcAddressStart, destinationAddressStart, PROGMEM_PAGE_SIZE);
+                if (byteCount < resumeOffset)
+                {
+                    errorStatus = BL_MEM_PASS;
+                }
+                else if (((byteCount <= copyEndOffset) && ((byteCount + PROGMEM_PAGE_SIZE) > copyStartOffset))
+                        || (byteCount >= footerPageOffset))
+                {
+                    // Perform the copy operation on the next page
+                    errorStatus = BL_FlashCopy(srcAddressStart, destinationAddressStart, PROGMEM_PAGE_SIZE);
+                }
+                else
+                {
+                    // The page is not part of the image; make sure nothing stale is left behind
+                    errorStatus = BL_FlashPageErase(destinationAddressStart);
+                }
 #ifdef PIC_ARCH
                 BL_MemoryUnlockKeysClear();
 #endif
@@ -444,11 +1171,29 @@ bl_result_t BL_CopyImageAreas(uint8_t srcImageId, uint8_t destImageId)
                     copyResult = BL_ERROR_COMMAND_PROCESSING;
                     break;
                 }
+#if BL_COPY_JOURNAL_ENABLED == 1
+                if ((byteCount >= resumeOffset) && (((byteCount + PROGMEM_PAGE_SIZE) % JOURNAL_GROUP_SIZE) == 0U))
+                {
+                    CopyJournalMark((uint8_t) (byteCount / JOURNAL_GROUP_SIZE));
+                }
+#endif
 
                 // Move to the next page
                 srcAddressStart += PROGMEM_PAGE_SIZE;
                 destinationAddressStart += PROGMEM_PAGE_SIZE;
             }
+#if BL_COPY_JOURNAL_ENABLED == 1
+            if (errorStatus == BL_MEM_PASS)
+            {
+                // A finished copy must not be skipped the next time the same image is copied
+                ReservedRowErase((flash_address_t) BL_COPY_JOURNAL_ADDRESS, 0x0000U);
+            }
+#endif
+#ifdef PIC_ARCH
+            // Return the keys to the state set by BL_InternalKeySet
+            coreMemoryKeys.eraseUnlockKey += BL_KEY_OPERATOR;
+            coreMemoryKeys.rowWriteUnlockKey += BL_KEY_OPERATOR;
+#endif
         }
 
         // Set the result status
@@ -457,4 +1202,303 @@ bl_result_t BL_CopyImageAreas(uint8_t srcImageId, uint8_t destImageId)
 
     return copyResult;
 }
+
+#if BL_COPY_JOURNAL_ENABLED == 1
+static uint32_t CopyJournalBegin(uint8_t srcImageId, uint8_t destImageId, const bl_footer_data_t * footerData)
+{
+    uint32_t resumeOffset = 0U;
+    flash_address_t journalAddress = (flash_address_t) BL_COPY_JOURNAL_ADDRESS;
+
+    if ((FLASH_Read(journalAddress + JOURNAL_MAGIC_OFFSET) == JOURNAL_MAGIC)
+            && (FLASH_Read(journalAddress + JOURNAL_SOURCE_OFFSET) == (flash_data_t) srcImageId)
+            && (FLASH_Read(journalAddress + JOURNAL_DESTINATION_OFFSET) == (flash_data_t) destImageId)
+            && (ReservedRowUint32Get(journalAddress + JOURNAL_CRC_OFFSET) == footerData->verificationData)
+            && (ReservedRowUint32Get(journalAddress + JOURNAL_VERSION_OFFSET) == footerData->applicationVersion))
+    {
+        // Resume after the last complete mark; a torn mark is programmed again when its group is done
+        uint8_t groupCount = 0U;
+
+        while ((groupCount < JOURNAL_MARK_COUNT)
+                && (FLASH_Read(journalAddress + JOURNAL_MARK_OFFSET + groupCount) == JOURNAL_MARK))
+        {
+            groupCount++;
+        }
+        resumeOffset = (uint32_t) groupCount * JOURNAL_GROUP_SIZE;
+    }
+    else
+    {
+        flash_data_t rowData[PROGMEM_PAGE_SIZE];
+
+        ReservedRowErasedFill(rowData);
+        rowData[JOURNAL_MAGIC_OFFSET] = JOURNAL_MAGIC;
+        rowData[JOURNAL_SOURCE_OFFSET] = (flash_data_t) srcImageId;
+        rowData[JOURNAL_DESTINATION_OFFSET] = (flash_data_t) destImageId;
+        for (uint8_t index = 0U; index < 4U; index++)
+        {
+            rowData[JOURNAL_CRC_OFFSET + index] = (flash_data_t) ((footerData->verificationData >> (8U * index)) & 0xFFU);
+            rowData[JOURNAL_VERSION_OFFSET + index] = (flash_data_t) ((footerData->applicationVersion >> (8U * index)) & 0xFFU);
+        }
+
+        ReservedRowErase(journalAddress, 0x0000U);
+        (void) ReservedRowProgram(journalAddress, rowData, 0x0000U);
+    }
+    return resumeOffset;
+}
+
+static void CopyJournalMark(uint8_t groupIndex)
+{
+    flash_data_t rowData[PROGMEM_PAGE_SIZE];
+
+    // Erased values leave the programmed locations untouched, so only this mark is written
+    ReservedRowErasedFill(rowData);
+    rowData[JOURNAL_MARK_OFFSET + groupIndex] = JOURNAL_MARK;
+
+    (void) ReservedRowProgram((flash_address_t) BL_COPY_JOURNAL_ADDRESS, rowData, 0x0000U);
+}
+#endif
+
+#if BL_INSTALLED_IMAGE_CHECK_ENABLED == 1
+bl_result_t BL_ImageInstalledCheck(const bl_footer_data_t * footerData)
+{
+    bl_result_t result = BL_ERROR_VERIFICATION_FAIL;
+    bl_footer_data_t installedFooter;
+    // Only the image that runs is installed; a staged or back-up copy has not been started yet.
+    // The download area is never checked, so it does not have to be finalized first.
+#if BL_SLOT_SWAP_ENABLED == 1
+    uint8_t imageId = BL_ApplicationActiveIdGet();
+#else
+    uint8_t imageId = (uint8_t) IMAGE_0;
+#endif
+
+    if ((BL_ApplicationFooterRead(imageId, &installedFooter) == true)
+            && (installedFooter.applicationVersion == footerData->applicationVersion)
+            && (installedFooter.verificationStartAddress == footerData->verificationStartAddress)
+            && (installedFooter.verificationEndAddress == footerData->verificationEndAddress)
+            && (installedFooter.verificationData == footerData->verificationData))
+    {
+        bool isVerified = false;
+#if BL_VERIFIED_MARKER_ENABLED == 1
+        uint8_t bootCount = 0U;
+
+        // The marker records a passing scan of this exact execution image
+        isVerified = ((imageId == (uint8_t) IMAGE_0) && (VerifiedMarkerMatch(footerData, &bootCount) == true));
+#endif
+        if (isVerified == false)
+        {
+            isVerified = (BL_ImageVerifyById(imageId) == BL_PASS);
+        }
+        if (isVerified == true)
+        {
+            result = BL_PASS;
+        }
+    }
+    return result;
+}
+#endif
+
+#if BL_VERIFIED_MARKER_ENABLED == 1
+bl_result_t BL_ExecutionImageVerify(void)
+{
+    bl_result_t result = BL_FAIL;
+    uint8_t bootCount = 0U;
+    bl_footer_data_t footerData;
+
+    // The marker is only trusted against a footer that was actually read
+    if ((BL_ApplicationFooterRead((uint8_t) IMAGE_0, &footerData) == true)
+            && (VerifiedMarkerMatch(&footerData, &bootCount) == true)
+#if BL_FULL_VERIFY_INTERVAL > 0
+            && ((bootCount + 1U) < BL_FULL_VERIFY_INTERVAL)
+#endif
+            )
+    {
+        // The execution image was verified on an earlier boot and has not been written since
+#if BL_FULL_VERIFY_INTERVAL > 0
+        VerifiedMarkerTallyAdd(bootCount);
+#endif
+        result = BL_PASS;
+    }
+    else
+    {
+        result = BL_ImageVerifyById((uint8_t) IMAGE_0);
+        if (result == BL_PASS)
+        {
+            VerifiedMarkerWrite(&footerData);
+        }
+        else
+        {
+            VerifiedMarkerErase();
+        }
+    }
+    return result;
+}
+
+static bool VerifiedMarkerMatch(const bl_footer_data_t * footerData, uint8_t * bootCount)
+{
+    bool isMatch = false;
+
+    if ((EEPROM_Read((eeprom_address_t) BL_VERIFIED_MARKER_ADDRESS + MARKER_MAGIC_OFFSET) == MARKER_MAGIC)
+            && (MarkerUint32Get(MARKER_CRC_OFFSET) == footerData->verificationData)
+            && (MarkerUint32Get(MARKER_VERSION_OFFSET) == footerData->applicationVersion))
+    {
+        isMatch = true;
+        // Number of boots that skipped the scan since the last full verification
+        *bootCount = EEPROM_Read((eeprom_address_t) BL_VERIFIED_MARKER_ADDRESS + MARKER_BOOT_COUNT_OFFSET);
+    }
+    return isMatch;
+}
+
+static void VerifiedMarkerWrite(const bl_footer_data_t * footerData)
+{
+    VerifiedMarkerErase();
+    for (uint8_t index = 0U; index < 4U; index++)
+    {
+        MarkerByteWrite(MARKER_CRC_OFFSET + index, (eeprom_data_t) ((footerData->verificationData >> (8U * index)) & 0xFFU));
+        MarkerByteWrite(MARKER_VERSION_OFFSET + index, (eeprom_data_t) ((footerData->applicationVersion >> (8U * index)) & 0xFFU));
+    }
+    MarkerByteWrite(MARKER_BOOT_COUNT_OFFSET, 0U);
+    MarkerByteWrite(MARKER_MAGIC_OFFSET, MARKER_MAGIC);
+}
+
+static void VerifiedMarkerTallyAdd(uint8_t bootCount)
+{
+    MarkerByteWrite(MARKER_BOOT_COUNT_OFFSET, bootCount + 1U);
+}
+
+static void VerifiedMarkerErase(void)
+{
+    MarkerByteWrite(MARKER_MAGIC_OFFSET, MARKER_ERASED_VALUE);
+}
+
+static void MarkerByteWrite(uint8_t offset, eeprom_data_t data)
+{
+    eeprom_address_t address = (eeprom_address_t) BL_VERIFIED_MARKER_ADDRESS + offset;
+
+    // Leave a byte that already holds the value alone to save a write cycle
+    if (EEPROM_Read(address) != data)
+    {
+#ifdef PIC_ARCH
+        // Only the first part of the internal keys is set while the marker is maintained
+        NVM_UnlockKeySet(coreMemoryKeys.byteWordWriteUnlockKey - BL_KEY_OPERATOR);
+#endif
+        EEPROM_Write(address, data);
+        while (NVM_IsBusy() == true)
+        {
+
+        }
+#ifdef PIC_ARCH
+        NVM_UnlockKeyClear();
+#endif
+    }
+}
+
+static uint32_t MarkerUint32Get(uint8_t offset)
+{
+    eeprom_address_t address = (eeprom_address_t) BL_VERIFIED_MARKER_ADDRESS + offset;
+
+    return (uint32_t) (
+            ((uint32_t) EEPROM_Read(address)) |
+            ((uint32_t) EEPROM_Read(address + 1U) << 8U) |
+            ((uint32_t) EEPROM_Read(address + 2U) << 16U) |
+            ((uint32_t) EEPROM_Read(address + 3U) << 24U)
+            );
+}
+#endif
+#endif
+
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+bl_result_t BL_ActiveImageSelect(void)
+{
+    bl_result_t result = BL_ERROR_VERIFICATION_FAIL;
+    uint32_t executionVersion = BL_ApplicationVersionGet((uint8_t) IMAGE_0);
+    uint32_t stagingVersion = BL_ApplicationVersionGet((uint8_t) BL_STAGING_IMAGE_ID);
+    uint8_t candidateId = (uint8_t) IMAGE_0;
+
+    // Scan the newer image first; the other slot is only scanned when the newer one fails
+    if ((BL_ApplicationIsVersionValid(stagingVersion) == true)
+            && ((BL_ApplicationIsVersionValid(executionVersion) == false) || (stagingVersion > executionVersion)))
+    {
+        candidateId = (uint8_t) BL_STAGING_IMAGE_ID;
+    }
+
+    for (uint8_t slotCount = 0U; (slotCount < 2U) && (result != BL_PASS); slotCount++)
+    {
+        result = BL_ImageVerifyById(candidateId);
+#if BL_ANTI_ROLLBACK_ENABLED == 1
+        if ((result == BL_PASS) && (BL_ApplicationIsVersionValid(BL_ApplicationVersionGet(candidateId)) == false))
+        {
+            // An image without a version is never run
+            result = BL_ERROR_ROLLBACK_FAILURE;
+        }
+#endif
+        if (result != BL_PASS)
+        {
+            candidateId = (candidateId == (uint8_t) IMAGE_0) ? (uint8_t) BL_STAGING_IMAGE_ID : (uint8_t) IMAGE_0;
+        }
+    }
+
+    // Without a valid image the next download goes to the staging area, as it does in the copy install mode
+    BL_ApplicationActiveIdSet((result == BL_PASS) ? candidateId : (uint8_t) IMAGE_0);
+    return result;
+}
+#endif
+
+#ifdef RESERVED_ROWS_USED
+static void ReservedRowErasedFill(flash_data_t * rowData)
+{
+    for (uint8_t index = 0U; index < PROGMEM_PAGE_SIZE; index++)
+    {
+        rowData[index] = ROW_ERASED_VALUE;
+    }
+}
+
+/* cppcheck-suppress misra-c2012-2.7 */
+static nvm_status_t ReservedRowProgram(flash_address_t address, flash_data_t * rowData, uint16_t keyOffset)
+{
+    nvm_status_t errorStatus;
+
+#ifdef PIC_ARCH
+    // The offset removes the part of the key that the caller has not applied yet
+    NVM_UnlockKeySet(coreMemoryKeys.rowWriteUnlockKey - keyOffset);
+#endif
+    errorStatus = FLASH_RowWrite(address, rowData);
+#ifdef PIC_ARCH
+    NVM_UnlockKeyClear();
+#endif
+    return errorStatus;
+}
+
+/* cppcheck-suppress misra-c2012-2.7 */
+static void ReservedRowErase(flash_address_t address, uint16_t keyOffset)
+{
+    // Leave a blank row alone to save an erase cycle
+    if (FLASH_Read(address) != ROW_ERASED_VALUE)
+    {
+#ifdef PIC_ARCH
+        NVM_UnlockKeySet(coreMemoryKeys.eraseUnlockKey - keyOffset);
+#endif
+        (void) FLASH_PageErase(address);
+#ifdef PIC_ARCH
+        while (NVM_IsBusy() == true)
+        {
+
+        }
+        NVM_UnlockKeyClear();
+#else
+        while (FLASH_IsBusy() == true)
+        {
+
+        }
+#endif
+    }
+}
+
+static uint32_t ReservedRowUint32Get(flash_address_t address)
+{
+    return (uint32_t) (
+            (((uint32_t) FLASH_Read(address) & 0x00FFU)) |
+            (((uint32_t) FLASH_Read(address + 1U) & 0x00FFU) << 8U) |
+            (((uint32_t) FLASH_Read(address + 2U) & 0x00FFU) << 16U) |
+            (((uint32_t) FLASH_Read(address + 3U) & 0x00FFU) << 24U)
+            );
+}
 #endif
@@ -52,6 +52,17 @@
  * @var bl_block_type_t:: WRITE_EEPROM
  * 0x03U - EEPROM Data Block - Identifies operational blocks
  * that need to be written into the EEPROM section of memory
+ * @var bl_block_type_t:: WRITE_FLASH_COMPRESSED
+ * 0x04U - Compressed Flash Data Block - Identifies operational blocks
+ * that hold a compressed stream of whole Flash pages. Each token byte is followed by its data.
+ * Bit 7 set - (bits 6..0 + 1) erased words, no data follows.
+ * Bit 7 clear - (bits 6..0 + 1) literal words, packed least significant bit first at the
+ * width of a program word and padded to a whole byte.
+ * @var bl_block_type_t:: WRITE_FLASH_DELTA
+ * 0x05U - Delta Flash Data Block - Identifies operational blocks
+ * that rebuild whole Flash pages against the execution image. Literal tokens match the
+ * compressed block. A token with bit 7 set copies (bits 6..0 + 1) words from the execution
+ * image space, starting at the 16-bit little-endian word offset that follows the token.
  */
 typedef enum
 {
@@ -60,6 +71,12 @@ typedef enum
 #if defined(BL_EEPROM_WRITE_ENABLED)
     WRITE_EEPROM        = 0x03U,
 #endif
+#if BL_COMPRESSED_WRITE_ENABLED == 1
+    WRITE_FLASH_COMPRESSED = 0x04U,
+#endif
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_DELTA_WRITE_ENABLED == 1)
+    WRITE_FLASH_DELTA   = 0x05U,
+#endif
 } bl_block_type_t;
 
 /**
@@ -118,15 +135,22 @@ typedef struct
 
 /**
  * @ingroup mdfu_client_8bit
- * @def BL_WRITE_BYTE_LENGTH
- * Maximum number of bytes that the bootloader can hold inside its process buffer.
+ * @def BL_PAGE_BYTE_LENGTH
+ * Number of data bytes that make up one Flash page in a WRITE_FLASH block.
  */
 #if (defined(PIC_ARCH) && !defined(_PIC18))
-#define BL_WRITE_BYTE_LENGTH        ((uint16_t) PROGMEM_PAGE_SIZE * 2U)
+#define BL_PAGE_BYTE_LENGTH         ((uint16_t) PROGMEM_PAGE_SIZE * 2U)
 #else
-#define BL_WRITE_BYTE_LENGTH        ((uint16_t) PROGMEM_PAGE_SIZE)
+#define BL_PAGE_BYTE_LENGTH         ((uint16_t) PROGMEM_PAGE_SIZE)
 #endif
 
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_WRITE_BYTE_LENGTH
+ * Maximum number of bytes that the bootloader can hold inside its process buffer.
+ */
+#define BL_WRITE_BYTE_LENGTH        ((uint16_t) (BL_PAGE_BYTE_LENGTH * BL_WRITE_PAGE_COUNT))
+
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_MAX_BUFFER_SIZE
@@ -147,7 +171,7 @@ bl_result_t BL_Initialize(void);
  * @ingroup mdfu_client_8bit
  * @brief Executes the required action based on the block type received in the bootloader data buffer
  * @param [in] commandBuffer - Pointer to the start of the bootloader operational data
- * @param [in] commandLength - Length of the new data received by the FTP
+ * @param [in] commandLength - Number of operational data bytes received at commandBuffer
  * @return @ref BL_PASS - Process cycle finished successfully
  * @return @ref BL_FAIL - Process cycle failed unexpectedly
  * @return @ref BL_ERROR_UNKNOWN_COMMAND - Process cycle encountered an unknown command
@@ -160,7 +184,7 @@ bl_result_t BL_BootCommandProcess(uint8_t * commandBuffer, uint16_t commandLengt
 /**
  * @ingroup mdfu_client_8bit
  * @brief Performs actions to jump the microcontroller (MCU) program counter to 
- * the application start address.
+ * the application start address. In slot swap mode, this is the start of the active image space.
  */
 void BL_ApplicationStart(void);
 
@@ -178,6 +202,74 @@ void BL_InternalKeySet(void);
 void BL_InternalKeyClear(void);
 #endif
 
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Erases every staging area page that has not been erased or programmed since the
+ * bootloader was unlocked. Does nothing while the core is locked.
+ * @param None.
+ * @return @ref BL_PASS - Every unused staging area page has been erased \n
+ * @return @ref BL_FAIL - A page erase failed \n
+ */
+bl_result_t BL_StagingAreaFinalize(void);
+
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Performs the erase of @ref BL_StagingAreaFinalize one page at a time. Each call erases at most one page,
+ * so the caller regains control between page erases.
+ * @param None.
+ * @return @ref BL_BUSY - A page has been erased and more may remain; call again \n
+ * @return @ref BL_PASS - Every unused staging area page has been erased \n
+ * @return @ref BL_FAIL - A page erase failed; the page stays unrecorded \n
+ */
+bl_result_t BL_StagingAreaFinalizeTask(void);
+
+#if BL_RANGE_CRC_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Reports whether an unlock block has been accepted since @ref BL_Initialize was called.
+ * @param None.
+ * @return true - The core is unlocked \n
+ * @return false - The core is locked \n
+ */
+bool BL_CoreUnlockStatusGet(void);
+#endif
+#endif
+
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Names the image of the transfer that is about to start. When the transfer session row holds an interrupted
+ * transfer of the same image, the next unlock keeps the staging area pages it recorded instead of erasing them.
+ * Must be called after @ref BL_Initialize.
+ * @param [in] imageVersion - Application version from the image footer
+ * @param [in] imageCrc - Verification CRC from the image footer
+ * @return None.
+ */
+void BL_TransferSessionOpen(uint32_t imageVersion, uint32_t imageCrc);
+
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Reads the transfer session row.
+ * @param [out] imageVersion - Application version of the recorded transfer
+ * @param [out] imageCrc - Verification CRC of the recorded transfer
+ * @param [out] resumeAddress - First address the host still has to send. In slot swap mode the start of the download
+ * area is given when no session is recorded.
+ * @return true - A transfer session is recorded \n
+ * @return false - The session row is blank and the image version and CRC are left unchanged \n
+ */
+bool BL_TransferSessionGet(uint32_t * imageVersion, uint32_t * imageCrc, uint32_t * resumeAddress);
+
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Ends the transfer session once the staged image has been verified, so a later Start Transfer no longer
+ * reports a resume point for a transfer that has completed. The session row is only erased while the core is unlocked.
+ * @param None.
+ * @return None.
+ */
+void BL_TransferSessionClose(void);
+#endif
+
 #if BL_APPLICATION_IMAGE_COUNT > 1
 /**
  * @ingroup mdfu_client_8bit
@@ -190,6 +282,51 @@ void BL_InternalKeyClear(void);
  * @return @ref BL_ERROR_COMMAND_PROCESSING - Copy operation failed at the memory layer
  */
 bl_result_t BL_CopyImageAreas(uint8_t srcImageId, uint8_t destImageId);
+
+#if BL_INSTALLED_IMAGE_CHECK_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Checks whether the running image is the valid image described by the given footer. The version,
+ * verification range and CRC must match. The running image is the execution image, or the active image space in
+ * slot swap mode. The execution image is accepted from the verified marker when it is enabled; otherwise the image
+ * is verified with a CRC scan.
+ * @param [in] footerData - Footer of the image the host is about to send. The application ID is not compared.
+ * @return @ref BL_PASS - The image is already installed \n
+ * @return @ref BL_ERROR_VERIFICATION_FAIL - The running image is a different or invalid image \n
+ */
+bl_result_t BL_ImageInstalledCheck(const bl_footer_data_t * footerData);
+#endif
+
+#if BL_VERIFIED_MARKER_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Verifies the execution image space, skipping the CRC scan when the verified marker in Data EEPROM shows the image
+ * already passed on an earlier boot. The marker is keyed to the footer CRC and version, is cleared whenever
+ * @ref BL_CopyImageAreas writes the execution image space and forces a full scan every
+ * @ref BL_FULL_VERIFY_INTERVAL boots.
+ * @pre @ref BL_InternalKeySet must be called first so that the marker can be updated.
+ * @param None.
+ * @return @ref BL_PASS - Execution image is valid \n
+ * @return @ref BL_ERROR_VERIFICATION_FAIL - Execution image verification failed \n
+ * @return @ref BL_ERROR_INVALID_ARGUMENTS - Execution image footer is not valid \n
+ * @return @ref BL_ERROR_ADDRESS_OUT_OF_RANGE - Execution image footer holds incorrect addresses \n
+ */
+bl_result_t BL_ExecutionImageVerify(void);
+#endif
+
+#if BL_SLOT_SWAP_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Selects the image space the application is started from in slot swap mode. The image with the newer
+ * footer version is verified first and the other image space is only verified when it fails. The image space
+ * that is not selected receives the next download.
+ * @param None.
+ * @return @ref BL_PASS - The selected image space holds a valid image \n
+ * @return @ref BL_ERROR_VERIFICATION_FAIL - Neither image space holds a valid image; IMAGE_0 is selected \n
+ * @return @ref BL_ERROR_ROLLBACK_FAILURE - The image scanned last is valid but does not have a version; IMAGE_0 is selected \n
+ */
+bl_result_t BL_ActiveImageSelect(void);
+#endif
 #endif
 
 #endif // BL_CORE_H
\ No newline at end of file
@@ -70,4 +70,14 @@ that may be reserved for compiler use or by debuggers.
 #endif
 
 extern volatile __persistent BL_INTERRUPT_FLAG_QUAL __bit bootloaderIsRunning;
+
+/*
+"stagingSlotIsActive" is a single bit that is only used when the slot swap install mode is enabled.
+When this is set to 1, the application runs from the staging area and its interrupts are sent to the
+staging area interrupt vector instead of the execution image space vector.
+It shares the byte of "bootloaderIsRunning" so the interrupt entry code does not change banks.
+*/
+#define BL_SLOT_FLAG_BIT_ADDRESS   (BL_INTERRUPT_FLAG_BIT_ADDRESS + 1)
+
+extern volatile __persistent BL_INTERRUPT_FLAG_QUAL __bit stagingSlotIsActive;
 #endif //BL_INTERRUPT_H
\ No newline at end of file
@@ -207,6 +207,36 @@ bl_mem_result_t BL_FlashWrite(flash_address_t address, flash_data_t * buffer, si
  */
 bl_mem_result_t BL_FlashCopy(flash_address_t srcAddress, flash_address_t destAddress, size_t length);
 
+/**
+ * @ingroup bl_memory
+ * @brief Erases the Flash page holding the given address unless the page is already blank.
+ * @param [in] address - Any address inside the page to erase
+ * @return @ref BL_MEM_PASS - Page is blank \n
+ * @return @ref BL_MEM_FAIL - Page erase failed \n
+ * @return @ref BL_MEM_INVALID_ARG - An invalid argument is passed to the function \n
+ */
+bl_mem_result_t BL_FlashPageErase(flash_address_t address);
+
+/**
+ * @ingroup bl_memory
+ * @brief Checks whether every word of a Flash page reads back as erased.
+ * @param [in] pageStartAddress - First address of the page to check
+ * @return true - Page is blank \n
+ * @return false - Page holds programmed data \n
+ */
+bool BL_FlashPageIsBlank(flash_address_t pageStartAddress);
+
+#if BL_FLASH_WRITE_COMPARE_ENABLED == 1
+/**
+ * @ingroup bl_memory
+ * @brief Returns the number of pages that @ref BL_FlashWrite left untouched because Flash already held the requested data.
+ * The count starts at zero on reset and stops at UINT16_MAX.
+ * @param None.
+ * @return Number of skipped pages since reset
+ */
+uint16_t BL_FlashSkippedPageCountGet(void);
+#endif
+
 #if defined(PIC_ARCH) && !defined(_PIC18)
 /**
 * @ingroup bl_memory
@@ -43,6 +43,7 @@
 #include "../system/pins.h"
 #include "../uart/eusart1.h"
 #include "../nvm/nvm.h"
+#include "../timer/tmr0.h"
 #include "../system/interrupt.h"
 #include "../system/clock.h"
 
@@ -0,0 +1,107 @@
+/**
+ * TMR0 Generated Driver File
+ * 
+ * @file tmr0.c
+ * 
+ * @ingroup tmr0
+ * 
+ * @brief This is the generated driver implementation file for the TMR0 driver.
+ *
+ * @version TMR0 Driver Version 3.0.0
+*/
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+/**
+  Section: Included Files
+*/
+#include <xc.h>
+#include "../tmr0.h"
+
+/**
+  Section: TMR0 APIs
+*/
+
+void TMR0_Initialize(void)
+{
+    //T0OUTPS 1:1; T0EN disabled; T016BIT 16-bit; 
+    T0CON0 = 0x10;
+    //T0CS LFINTOSC; T0CKPS 1:32; T0ASYNC not_synchronised; 
+    T0CON1 = 0x95;
+    //TMR0H 0; 
+    TMR0H = 0x0;
+    //TMR0L 0; 
+    TMR0L = 0x0;
+    //Clear Interrupt flag before enabling the interrupt
+    PIR0bits.TMR0IF = 0;
+    //TMR0IE disabled; 
+    PIE0bits.TMR0IE = 0;
+}
+
+void TMR0_Deinitialize(void)
+{
+    T0CON0bits.T0EN = 0;
+    T0CON0 = 0x0;
+    T0CON1 = 0x0;
+    TMR0H = 0xFF;
+    TMR0L = 0x0;
+    PIR0bits.TMR0IF = 0;
+    PIE0bits.TMR0IE = 0;
+}
+
+void TMR0_Start(void)
+{
+    T0CON0bits.T0EN = 1;
+}
+
+void TMR0_Stop(void)
+{
+    T0CON0bits.T0EN = 0;
+}
+
+uint16_t TMR0_CounterGet(void)
+{
+    uint8_t readValLow;
+    uint8_t readValHigh;
+
+    // Reading TMR0L latches TMR0H from the high byte buffer
+    readValLow = TMR0L;
+    readValHigh = TMR0H;
+    return (((uint16_t)readValHigh << 8) | (uint16_t)readValLow);
+}
+
+void TMR0_CounterSet(uint16_t counterValue)
+{
+    // Writing TMR0L loads the high byte buffer into the counter as well
+    TMR0H = (uint8_t)(counterValue >> 8);
+    TMR0L = (uint8_t)(counterValue & 0xFFU);
+}
+
+bool TMR0_OverflowStatusGet(void)
+{
+    return (bool)PIR0bits.TMR0IF;
+}
+
+void TMR0_OverflowStatusClear(void)
+{
+    PIR0bits.TMR0IF = 0;
+}
@@ -61,10 +61,14 @@
 #define SERCOM_TransmitDisable      EUSART1_TransmitDisable
 #define SERCOM_AutoBaudSet          EUSART1_AutoBaudSet
 #define SERCOM_AutoBaudQuery        EUSART1_AutoBaudQuery
-#define SERCOM_BRGCountSet                (NULL)
-#define SERCOM_BRGCountGet                (NULL)
-#define SERCOM_BaudRateSet                (NULL)
-#define SERCOM_BaudRateGet                (NULL)
+#define SERCOM_IsAutoBaudDetectOverflow     EUSART1_IsAutoBaudDetectOverflow
+#define SERCOM_AutoBaudDetectOverflowReset  EUSART1_AutoBaudDetectOverflowReset
+#define SERCOM_BRGCountSet          EUSART1_BRGCountSet
+#define SERCOM_BRGCountGet          EUSART1_BRGCountGet
+#define SERCOM_BaudRateSet          EUSART1_BaudRateSet
+#define SERCOM_BaudRateGet          EUSART1_BaudRateGet
+#define SERCOM_BRGCountCalculate    EUSART1_BRGCountCalculate
+#define SERCOM_BaudRateCalculate    EUSART1_BaudRateCalculate
 #define SERCOM__AutoBaudEventEnableGet    (NULL)
 #define SERCOM_ErrorGet             EUSART1_ErrorGet
 
@@ -174,7 +178,6 @@ void EUSART1_ReceiveEnable(void);
  */
 void EUSART1_ReceiveDisable(void);
 
-
 /**
  * @ingroup eusart1
  * @brief This API enables the EUSART1 to send a break control. 
@@ -223,6 +226,56 @@ bool EUSART1_IsAutoBaudDetectOverflow(void);
  */
 void EUSART1_AutoBaudDetectOverflowReset(void);
 
+/**
+ * @ingroup eusart1
+ * @brief This API writes the 16-bit EUSART1 Baud Rate Generator count.
+ * @param uint32_t brgValue - Value loaded into SP1BRGH:SP1BRGL.
+ * @return None.
+ */
+void EUSART1_BRGCountSet(uint32_t brgValue);
+
+/**
+ * @ingroup eusart1
+ * @brief This API reads the 16-bit EUSART1 Baud Rate Generator count.
+ * @param None.
+ * @return uint32_t - Value held in SP1BRGH:SP1BRGL.
+ */
+uint32_t EUSART1_BRGCountGet(void);
+
+/**
+ * @ingroup eusart1
+ * @brief This API returns the EUSART1 Baud Rate Generator count closest to the requested baud rate without
+ * writing it to the generator. The count is limited to 16 bits.
+ * @param uint32_t baudRate - Requested baud rate in bits per second.
+ * @return uint32_t - Count for SP1BRGH:SP1BRGL.
+ */
+uint32_t EUSART1_BRGCountCalculate(uint32_t baudRate);
+
+/**
+ * @ingroup eusart1
+ * @brief This API returns the baud rate that a given EUSART1 Baud Rate Generator count produces.
+ * @param uint32_t brgValue - Count for SP1BRGH:SP1BRGL.
+ * @return uint32_t - Baud rate in bits per second.
+ */
+uint32_t EUSART1_BaudRateCalculate(uint32_t brgValue);
+
+/**
+ * @ingroup eusart1
+ * @brief This API sets the EUSART1 Baud Rate Generator count closest to the requested baud rate.
+ * The generator runs in 16-bit, high-speed mode, so the baud rate is _XTAL_FREQ / (4 * (count + 1)).
+ * @param uint32_t baudRate - Requested baud rate in bits per second.
+ * @return None.
+ */
+void EUSART1_BaudRateSet(uint32_t baudRate);
+
+/**
+ * @ingroup eusart1
+ * @brief This API returns the baud rate produced by the current EUSART1 Baud Rate Generator count.
+ * @param None.
+ * @return uint32_t - Baud rate in bits per second.
+ */
+uint32_t EUSART1_BaudRateGet(void);
+
 /**
  * @ingroup eusart1
  * @brief This API checks if the EUSART1 has received available data.
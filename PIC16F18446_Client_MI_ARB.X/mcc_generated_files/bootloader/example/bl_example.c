@@ -82,6 +82,9 @@ static bool isExecutionAreaValidated = false;
 static bool executionImageHasBeenTested = false;
 
 static bool ForcedEntryCheck(void);
+#if BL_SLOT_SWAP_ENABLED != 1
+static bl_result_t ExecutionImageVerify(void);
+#endif
 
 void BL_Example(void)
 {
@@ -93,6 +96,8 @@ void BL_Example(void)
     {
     case APPLICATION:
         BL_INDICATOR_OFF();
+        // Release the timer borrowed for the baud rate fallback before the application starts
+        FTP_Deinitialize();
         // Switch the interrupt flag to handle application interrupts 
         bootloaderIsRunning = 0;
         BL_ApplicationStart();
@@ -136,7 +141,11 @@ static bl_result_t LoadImageBackup(void)
         loadStatus = BL_CopyImageAreas(BL_BACKUP_IMAGE_ID, IMAGE_0);
 
         // Verify the execution space after the copy step and return the result
-        loadStatus = BL_ImageVerifyById(IMAGE_0);
+        if (BL_PASS == loadStatus)
+        {
+            loadStatus = BL_ImageVerifyById(IMAGE_0);
+        }
+        isExecutionAreaValidated = (loadStatus == BL_PASS);
     }
     else
     {
@@ -145,9 +154,34 @@ static bl_result_t LoadImageBackup(void)
 
     return loadStatus;
 }
+
+static void BackupImageRefresh(void)
+{
+    bl_footer_data_t executionFooter;
+    bl_footer_data_t backupFooter;
+    bool isExecutionImageRunning = true;
+
+#if BL_SLOT_SWAP_ENABLED == 1
+    // Only an image linked for the execution image space can be restored into it
+    isExecutionImageRunning = (BL_ApplicationActiveIdGet() == (uint8_t) IMAGE_0);
+#endif
+    (void) BL_ApplicationFooterRead(IMAGE_0, &executionFooter);
+    (void) BL_ApplicationFooterRead(BL_BACKUP_IMAGE_ID, &backupFooter);
+
+    /**
+     * The backup is only rewritten after a different image has been installed.
+     * The copy covers the range declared by the execution image footer and the footer page.
+     */
+    if ((true == isExecutionImageRunning)
+            && ((executionFooter.applicationVersion != backupFooter.applicationVersion)
+                || (executionFooter.verificationData != backupFooter.verificationData)))
+    {
+        (void) BL_CopyImageAreas(IMAGE_0, BL_BACKUP_IMAGE_ID);
+    }
+}
 #endif
 
-#if BL_APPLICATION_IMAGE_COUNT > 1
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED != 1)
 
 static bl_result_t LoadNewImage(void)
 {
@@ -173,7 +207,14 @@ static bl_result_t LoadNewImage(void)
          */
 
         // Verify the target location
-        isTargetImageValid = (BL_PASS == BL_ImageVerifyById(targetId));
+        if (targetId == IMAGE_0)
+        {
+            isTargetImageValid = (BL_PASS == ExecutionImageVerify());
+        }
+        else
+        {
+            isTargetImageValid = (BL_PASS == BL_ImageVerifyById(targetId));
+        }
 
 
         // If the execution space was just tested; log the results and set the flag to prevent re-verification later.
@@ -223,20 +264,37 @@ static bl_result_t LoadNewImage(void)
 #endif
     if (true == stagedImageRequiresLoading)
     {
-        // Copy the staged image into the target location
+        // Copy the staged image into the target location; a copy cut short by a reset resumes from the copy journal
         loadStatus = BL_CopyImageAreas(BL_STAGING_IMAGE_ID, targetId);
 
         // We need to verify the copied data is valid.
         if (BL_PASS == loadStatus)
         {
-            loadStatus = BL_ImageVerifyById(targetId);
-
             // If the target image is the execution space, then we need to reset the static flags for the execution status
             if (targetId == IMAGE_0)
             {
+#if BL_VERIFIED_MARKER_ENABLED == 1
+                loadStatus = BL_ExecutionImageVerify();
+#else
+                loadStatus = BL_ImageVerifyById(targetId);
+#endif
                 isExecutionAreaValidated = (loadStatus == BL_PASS);
                 executionImageHasBeenTested = true;
             }
+            else
+            {
+                loadStatus = BL_ImageVerifyById(targetId);
+            }
+        }
+        else if (targetId == IMAGE_0)
+        {
+            // A failed copy leaves the execution space partly written; it must be verified again
+            isExecutionAreaValidated = false;
+            executionImageHasBeenTested = false;
+        }
+        else
+        {
+            // The copy into another image space failed; the execution space was not touched
         }
     }
 #ifdef PIC_ARCH
@@ -265,6 +323,10 @@ bl_example_result_t BL_ExampleInitialize(void)
 #warning "Customize the Initialization steps for the startup process and set the BootState accordingly."
         // Make assumption: We always start in bootload state
         BootState = BOOTLOADER;
+#if BL_SLOT_SWAP_ENABLED == 1
+        // The image space selected here runs the application; the other one receives a download even on a forced entry
+        isExecutionAreaValidated = (BL_PASS == BL_ActiveImageSelect());
+#endif
 
         // If forced entry is requested, enter bootloader
         if (ForcedEntryCheck() == true)
@@ -273,6 +335,13 @@ bl_example_result_t BL_ExampleInitialize(void)
         }
         else
         {
+#if BL_SLOT_SWAP_ENABLED == 1
+            /**
+             * In slot swap mode, an update is installed by selecting the newest valid image space at startup; nothing is copied.
+             * Stay in bootloader mode if neither image space holds a valid image.
+             */
+            BootState = (true == isExecutionAreaValidated) ? APPLICATION : BOOTLOADER;
+#else
             /**
              *  We have 3 operations that need to occur in order whenever the device starts up
              *      1. Determine if the staging area needs to be loaded into the target location.
@@ -310,7 +379,7 @@ bl_example_result_t BL_ExampleInitialize(void)
                 if (executionImageHasBeenTested == false)
                 {
                     // Run the verification if we have not done so already
-                    isExecutionAreaValidated = (BL_PASS == BL_ImageVerifyById(IMAGE_0));
+                    isExecutionAreaValidated = (BL_PASS == ExecutionImageVerify());
                 }
 
                 // Set the initial status based on the execution space's status
@@ -372,6 +441,7 @@ bl_example_result_t BL_ExampleInitialize(void)
                     initStatus = BL_PASS;
 #endif
             }
+#endif
 
 #ifdef PIC_ARCH
             // Set the first phase of the unlock keys
@@ -389,6 +459,15 @@ bl_example_result_t BL_ExampleInitialize(void)
                 initStatus = LoadImageBackup();
                 BootState = (initStatus == BL_PASS) ? APPLICATION : BOOTLOADER;
             }
+            else if (true == isExecutionAreaValidated)
+            {
+                // Keep a copy of the verified execution image for the next time it fails
+                BackupImageRefresh();
+            }
+            else
+            {
+                // Execution image is not valid and a bootload has been requested
+            }
 #endif
 #ifdef PIC_ARCH
             BL_InternalKeyClear();
@@ -403,6 +482,27 @@ bl_example_result_t BL_ExampleInitialize(void)
     return EXAMPLE_OK;
 }
 
+#if BL_SLOT_SWAP_ENABLED != 1
+static bl_result_t ExecutionImageVerify(void)
+{
+    bl_result_t verifyStatus = BL_FAIL;
+
+#if BL_VERIFIED_MARKER_ENABLED == 1
+    // The verified marker row is updated by the check so the memory keys must be set around it
+#ifdef PIC_ARCH
+    BL_InternalKeySet();
+#endif
+    verifyStatus = BL_ExecutionImageVerify();
+#ifdef PIC_ARCH
+    BL_InternalKeyClear();
+#endif
+#else
+    verifyStatus = BL_ImageVerifyById(IMAGE_0);
+#endif
+    return verifyStatus;
+}
+#endif
+
 static bool ForcedEntryCheck(void)
 {
     bool result = false;
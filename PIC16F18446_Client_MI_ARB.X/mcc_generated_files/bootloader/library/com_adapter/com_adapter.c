@@ -75,34 +75,90 @@ static ftp_special_characters_t ftpSpecialCharacters = {
     .EndOfPacketCharacter = END_OF_PACKET_BYTE
 };
 
+/**
+ * @ingroup com_adapter
+ * @def BAUD_FALLBACK_TIMER_PRELOAD
+ * Timer0 count that overflows once COM_BAUD_FALLBACK_TIMEOUT_MS has elapsed, so the latched overflow flag
+ * alone tells that the timeout has passed however rarely it is polled.
+ */
+#define BAUD_FALLBACK_TIMER_PRELOAD     ((uint16_t) (0x10000UL - (((uint32_t) COM_BAUD_FALLBACK_TIMEOUT_MS * TMR0_CLOCK_FREQUENCY) / 1000UL)))
+/**
+ * @ingroup com_adapter
+ * @def BAUD_RATE_ERROR_DIVISOR
+ * Requested baud rate divided by this value gives the largest accepted baud rate error (2%).
+ */
+#define BAUD_RATE_ERROR_DIVISOR         (50U)
+
 static uint16_t MaxBufferLength = 0U;
 static bool isReceiveWindowOpen = false;
 static bool isEscapedByte= false;
+/* Running sum of the received frame bytes, trailing the receive index by FRAME_CHECK_SIZE bytes */
+static uint16_t receiveChecksum = 0U;
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+/* Running CRC of the same bytes and the frame check currently used by the host */
+static uint16_t receiveCrc = 0xFFFFU;
+static com_frame_check_t frameCheckType = COM_FRAME_CHECK_CHECKSUM;
+
+/* cppcheck-suppress misra-c2012-8.9 */
+static const uint16_t crc16Table[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+#endif
+
+/* BRG count restored by the fallback, count in use and count waiting for the next frame to be sent */
+static uint32_t defaultBrgCount = 0U;
+static uint32_t activeBrgCount = 0U;
+static uint32_t pendingBrgCount = 0U;
+static bool isBaudRateChangePending = false;
+/* Set while Timer0 is counting down to the fallback of an unconfirmed baud rate change */
+static bool isBaudFallbackArmed = false;
+#if COM_AUTO_BAUD_ENABLED == 1
+/* Set while SERCOM is measuring the sync character and until the host rate has been proven by a valid frame */
+static bool isAutoBaudPending = false;
+static bool isAutoBaudConfirmed = false;
+#endif
 
 static com_adapter_result_t DataSend(uint8_t *data, size_t length);
 static com_adapter_result_t DataReceive(uint8_t *data, size_t length);
+static void SercomReset(void);
+static void BaudFallbackTimerStart(void);
+static void BaudFallbackTimerStop(void);
+static void BaudFallbackCheck(com_adapter_result_t frameResult);
+#if COM_AUTO_BAUD_ENABLED == 1
+static void AutoBaudArm(void);
+static bool AutoBaudIsLocked(void);
+#endif
+static com_adapter_result_t FrameByteProcess(uint8_t nextByte, uint8_t *receiveBufferPtr, uint16_t *receiveIndexPtr);
 
-static uint16_t FrameCheckCalculate(uint8_t * ftpData, uint16_t bufferLength)
+static uint16_t FrameCheckByteAdd(uint16_t checksum, uint8_t data, uint16_t byteIndex)
 {
-    uint16_t numBytesChecksummed = 0;
-    uint16_t checksum = 0;
+    uint16_t updatedChecksum;
 
-    while (numBytesChecksummed < (bufferLength))
+    // Even bytes are the low byte and odd bytes the high byte of each 16-bit word in the sum
+    if ((byteIndex & 1U) == 0U)
     {
-        if ((numBytesChecksummed % 2U) == 0U)
-        {
-            checksum += ((uint16_t) (ftpData[numBytesChecksummed]));
-        }
-        else
-        {
-            checksum += (((uint16_t) (ftpData[numBytesChecksummed])) << 8);
-        }
-        numBytesChecksummed++;
+        updatedChecksum = checksum + ((uint16_t) data);
+    }
+    else
+    {
+        updatedChecksum = checksum + (((uint16_t) data) << 8);
     }
 
-    return ~checksum;
+    return updatedChecksum;
 }
 
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+static uint16_t FrameCheckCrc16Update(uint16_t crc, uint8_t data)
+{
+    // Process the byte one nibble at a time, most significant nibble first
+    uint16_t updatedCrc = (uint16_t) (crc << 4) ^ crc16Table[((crc >> 12) ^ ((uint16_t) data >> 4)) & 0x0FU];
+    updatedCrc = (uint16_t) (updatedCrc << 4) ^ crc16Table[((updatedCrc >> 12) ^ (uint16_t) data) & 0x0FU];
+
+    return updatedCrc;
+}
+#endif
+
 static com_adapter_result_t DataSend(uint8_t *data, size_t length)
 {
     com_adapter_result_t status = COM_PASS;
@@ -153,127 +209,300 @@ static com_adapter_result_t DataReceive(uint8_t *data, size_t length)
         {
             status = COM_PASS;
 
-            if (SERCOM_ErrorGet() == 0U)
+            if (SERCOM_IsRxReady() == true)
             {
-                if (SERCOM_IsRxReady() == true)
-                {
-                    data[byteIndex] = SERCOM_Read();
-                }
-                else
+                data[byteIndex] = SERCOM_Read();
+                // The driver error status describes the byte just read, so check it before trusting the byte
+                if (SERCOM_ErrorGet() != 0U)
                 {
                     status = COM_FAIL;
+                    // Fully reset the UART
+                    SercomReset();
                 }
             }
             else
             {
                 status = COM_FAIL;
-                // Fully reset the UART
-                SERCOM_Deinitialize();
-                SERCOM_Initialize();
             }
         }
     }
     return status;
 }
 
-com_adapter_result_t COM_FrameTransfer(uint8_t *receiveBufferPtr, uint16_t *receiveIndexPtr)
+static void SercomReset(void)
+{
+    SERCOM_Deinitialize();
+    SERCOM_Initialize();
+    // Keep the negotiated baud rate across error recovery
+    SERCOM_BRGCountSet(activeBrgCount);
+#if COM_AUTO_BAUD_ENABLED == 1
+    if (isAutoBaudConfirmed == false)
+    {
+        // Errors before the first valid frame suggest the measured rate is wrong
+        AutoBaudArm();
+    }
+#endif
+}
+
+#if COM_AUTO_BAUD_ENABLED == 1
+static void AutoBaudArm(void)
+{
+    isAutoBaudPending = true;
+    isReceiveWindowOpen = false;
+    SERCOM_AutoBaudDetectOverflowReset();
+    SERCOM_AutoBaudSet(true);
+}
+
+static bool AutoBaudIsLocked(void)
+{
+    if (isAutoBaudPending)
+    {
+        if (SERCOM_IsAutoBaudDetectOverflow())
+        {
+            // The line was held low too long to be a sync character; measure again
+            SERCOM_AutoBaudSet(false);
+            AutoBaudArm();
+        }
+        else if (SERCOM_AutoBaudQuery())
+        {
+            // The hardware has loaded the measured count. The sync character itself is not a start of packet
+            // byte, so it is dropped by the frame parser.
+            activeBrgCount = SERCOM_BRGCountGet();
+            defaultBrgCount = activeBrgCount;
+            isAutoBaudPending = false;
+        }
+        else
+        {
+            // Still measuring
+        }
+    }
+    return (isAutoBaudPending == false);
+}
+#endif
+
+static void BaudFallbackTimerStart(void)
+{
+    TMR0_Initialize();
+    TMR0_CounterSet(BAUD_FALLBACK_TIMER_PRELOAD);
+    TMR0_Start();
+    isBaudFallbackArmed = true;
+}
+
+static void BaudFallbackTimerStop(void)
+{
+    // Return Timer0 to its reset state so that the application finds it untouched
+    TMR0_Deinitialize();
+    isBaudFallbackArmed = false;
+}
+
+static void BaudFallbackCheck(com_adapter_result_t frameResult)
+{
+    if (isBaudFallbackArmed == true)
+    {
+        if (frameResult == COM_PASS)
+        {
+            // The host is talking at the new rate
+            BaudFallbackTimerStop();
+        }
+        else if (TMR0_OverflowStatusGet() == true)
+        {
+            // The host never arrived at the new rate; return to the default and drop any partial frame
+            BaudFallbackTimerStop();
+            activeBrgCount = defaultBrgCount;
+            SERCOM_BRGCountSet(activeBrgCount);
+            isReceiveWindowOpen = false;
+        }
+        else
+        {
+            // Still waiting for the host
+        }
+    }
+}
+
+static com_adapter_result_t FrameByteProcess(uint8_t nextByte, uint8_t *receiveBufferPtr, uint16_t *receiveIndexPtr)
 {
-    uint8_t nextByte = 0U;
     com_adapter_result_t processResult = COM_FAIL;
 
-    if ((receiveBufferPtr == NULL) || (receiveIndexPtr == NULL))
+    if (nextByte == ftpSpecialCharacters.StartOfPacketCharacter)
     {
-        processResult = COM_INVALID_ARG;
+        // Open the buffer window
+        isReceiveWindowOpen = true;
+        isEscapedByte = false;
+        receiveChecksum = 0U;
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+        receiveCrc = 0xFFFFU;
+#endif
+        // Reset the buffer index
+        *receiveIndexPtr = 0U;
+
+        processResult = COM_BUSY;
     }
-    else
+    else if (isReceiveWindowOpen)
     {
-        if (SERCOM_IsRxReady() == true)
+        if (nextByte == ftpSpecialCharacters.EndOfPacketCharacter)
         {
-            processResult = DataReceive(&nextByte, 1U);
+            // Close the buffer window
+            isReceiveWindowOpen = false;
+
+            // The running sum already covers every byte in front of the frame check sequence
+            uint16_t fcs = ~receiveChecksum;
+
+            // Read FCS from the transfer buffer
+            uint16_t frameCheckSequence = 0x0000;
+            if (*receiveIndexPtr >= FRAME_CHECK_SIZE)
+            {
+                uint8_t *startOfWord = &receiveBufferPtr[*receiveIndexPtr - FRAME_CHECK_SIZE];
+                uint8_t * workPtr = startOfWord;
+                uint8_t lowByte = *workPtr;
+                workPtr++;
+                uint8_t highByte = *workPtr;
+                frameCheckSequence = (uint16_t) ((((uint16_t) highByte) << 8) | lowByte);
+            }
+
+            if (*receiveIndexPtr < FRAME_CHECK_SIZE)
+            {
+                // Too short to hold a frame check sequence
+                processResult = COM_TRANSPORT_FAILURE;
+            }
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+            else if (fcs == frameCheckSequence)
+            {
+                // A checksum frame is always accepted and answered with a checksum so the host can fall back at any time
+                frameCheckType = COM_FRAME_CHECK_CHECKSUM;
+                processResult = COM_PASS;
+            }
+            else if (receiveCrc == frameCheckSequence)
+            {
+                // The host has opted in to the CRC-16 frame check for this command; answer it with CRC-16
+                frameCheckType = COM_FRAME_CHECK_CRC16;
+                processResult = COM_PASS;
+            }
+#else
+            else if (fcs == frameCheckSequence)
+            {
+                // Set the status to execute the command
+                processResult = COM_PASS;
+            }
+#endif
+            else
+            {
+                // Set the status to execute the command
+                processResult = COM_TRANSPORT_FAILURE;
+            }
         }
-        if (processResult == COM_PASS)
+        else if (nextByte == ftpSpecialCharacters.EscapeCharacter)
         {
-            if (nextByte == ftpSpecialCharacters.StartOfPacketCharacter)
+            isEscapedByte = true;
+            processResult = COM_BUSY;
+        }
+        else
+        {
+            // If escape was flagged perform the bit flip to correct the byte
+            if (isEscapedByte)
             {
-                // Open the buffer window
-                isReceiveWindowOpen = true;
+                nextByte = ~nextByte;
                 isEscapedByte = false;
-                // Reset the buffer index
-                *receiveIndexPtr = 0U;
+            }
+
+            // Route the byte into the transfer buffer
+            if (*receiveIndexPtr < MaxBufferLength)
+            {
+                receiveBufferPtr[*receiveIndexPtr] = nextByte;
 
+                // Only the byte FRAME_CHECK_SIZE positions back is known to be payload, so sum that one
+                if (*receiveIndexPtr >= FRAME_CHECK_SIZE)
+                {
+                    uint16_t delayedIndex = *receiveIndexPtr - FRAME_CHECK_SIZE;
+                    receiveChecksum = FrameCheckByteAdd(receiveChecksum, receiveBufferPtr[delayedIndex], delayedIndex);
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+                    receiveCrc = FrameCheckCrc16Update(receiveCrc, receiveBufferPtr[delayedIndex]);
+#endif
+                }
+                (*receiveIndexPtr)++;
                 processResult = COM_BUSY;
             }
-            else if (isReceiveWindowOpen)
+            else
             {
-                if (nextByte == ftpSpecialCharacters.EndOfPacketCharacter)
-                {
-                    // Close the buffer window
-                    isReceiveWindowOpen = false;
+                // Close the buffer window
+                isReceiveWindowOpen = false;
+                processResult = COM_BUFFER_ERROR;
+            }
+        }
+    }
+    else
+    {
+        processResult = COM_FAIL;
+    }
 
-                    // Calculate the frame check here
-                    uint16_t fcs = FrameCheckCalculate(receiveBufferPtr, *receiveIndexPtr - FRAME_CHECK_SIZE);
+    return processResult;
+}
 
-                    // Read FCS from the transfer buffer
-                    uint8_t *startOfWord = &receiveBufferPtr[*receiveIndexPtr - FRAME_CHECK_SIZE];
-                    uint16_t frameCheckSequence = 0x0000;
-                    if (startOfWord != NULL)
-                    {
-                        uint8_t * workPtr = startOfWord;
-                        uint8_t lowByte = *workPtr;
-                        workPtr++;
-                        uint8_t highByte = *workPtr;
-                        frameCheckSequence = (uint16_t) ((((uint16_t) highByte) << 8) | lowByte);
-                    }
+com_adapter_result_t COM_FrameTransfer(uint8_t *receiveBufferPtr, uint16_t *receiveIndexPtr)
+{
+    uint8_t nextByte = 0U;
+    com_adapter_result_t processResult = COM_FAIL;
 
-                    if (fcs == frameCheckSequence)
-                    {
-                        // Set the status to execute the command
-                        processResult = COM_PASS;
-                    }
-                    else
-                    {
-                        // Set the status to execute the command
-                        processResult = COM_TRANSPORT_FAILURE;
-                    }
-                }
-                else if (nextByte == ftpSpecialCharacters.EscapeCharacter)
-                {
-                    isEscapedByte = true;
-                    processResult = COM_BUSY;
-                }
-                else
-                {
-                    // If escape was flagged perform the bit flip to correct the byte
-                    if (isEscapedByte)
-                    {
-                        nextByte = ~nextByte;
-                        isEscapedByte = false;
-                    }
+    if ((receiveBufferPtr == NULL) || (receiveIndexPtr == NULL))
+    {
+        processResult = COM_INVALID_ARG;
+    }
+    else
+    {
+#if COM_AUTO_BAUD_ENABLED == 1
+        // Nothing is parsed until the baud rate generator holds the measured host rate
+        bool isByteAvailable = false;
+        if (AutoBaudIsLocked())
+        {
+            isByteAvailable = SERCOM_IsRxReady();
+        }
+        else
+        {
+            processResult = COM_BUSY;
+        }
+#else
+        bool isByteAvailable = SERCOM_IsRxReady();
+#endif
 
-                    // Route the byte into the transfer buffer
-                    if (*receiveIndexPtr < MaxBufferLength)
-                    {
-                        receiveBufferPtr[*receiveIndexPtr] = nextByte;
-                        (*receiveIndexPtr)++;
-                        processResult = COM_BUSY;
-                    }
-                    else
-                    {
-                        // Close the buffer window
-                        isReceiveWindowOpen = false;
-                        processResult = COM_BUFFER_ERROR;
-                    }
-                }
+        // Drain every byte already received until a frame is complete or the transfer fails
+        while (isByteAvailable)
+        {
+            processResult = DataReceive(&nextByte, 1U);
+
+            if (processResult == COM_PASS)
+            {
+                processResult = FrameByteProcess(nextByte, receiveBufferPtr, receiveIndexPtr);
             }
             else
             {
                 processResult = COM_FAIL;
             }
+
+            if ((processResult == COM_BUSY) || (processResult == COM_FAIL))
+            {
+                isByteAvailable = SERCOM_IsRxReady();
+            }
+            else
+            {
+                // Leave the remaining bytes in the buffer for the next frame
+                isByteAvailable = false;
+            }
+        }
+
+        BaudFallbackCheck(processResult);
+#if COM_AUTO_BAUD_ENABLED == 1
+        if (processResult == COM_PASS)
+        {
+            isAutoBaudConfirmed = true;
+        }
+        else if ((isAutoBaudConfirmed == false) && ((processResult == COM_TRANSPORT_FAILURE) || (processResult == COM_BUFFER_ERROR)))
+        {
+            AutoBaudArm();
         }
         else
         {
-            processResult = COM_FAIL;
+            // Keep the current rate
         }
+#endif
     }
     return processResult;
 }
@@ -288,8 +517,14 @@ com_adapter_result_t COM_FrameSet(uint8_t *responseBufferPtr, uint16_t responseL
     }
     else
     {
-        // Integrity Check
-        uint16_t frameCheck = FrameCheckCalculate(responseBufferPtr, responseLength);
+        // Integrity check, accumulated as the payload bytes are sent
+        uint16_t frameCheck = 0U;
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+        if (frameCheckType == COM_FRAME_CHECK_CRC16)
+        {
+            frameCheck = 0xFFFFU;
+        }
+#endif
 
         processResult = DataSend(&(ftpSpecialCharacters.StartOfPacketCharacter), 1U);
 
@@ -302,7 +537,15 @@ com_adapter_result_t COM_FrameSet(uint8_t *responseBufferPtr, uint16_t responseL
             {/* cppcheck-suppress misra-c2012-15.4 */
                 if(sentByteCount == responseLength)
                 {
-                    // send the low byte first
+                    // The payload is complete; finalize the frame check and send the low byte first
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+                    if (frameCheckType == COM_FRAME_CHECK_CHECKSUM)
+                    {
+                        frameCheck = ~frameCheck;
+                    }
+#else
+                    frameCheck = ~frameCheck;
+#endif
                     nextByte = (uint8_t)(frameCheck & 0x00FFU);
                 }
                 else if(sentByteCount == (responseLength + 1U))
@@ -313,6 +556,18 @@ com_adapter_result_t COM_FrameSet(uint8_t *responseBufferPtr, uint16_t responseL
                 else
                 {
                     nextByte = responseBufferPtr[sentByteCount];
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+                    if (frameCheckType == COM_FRAME_CHECK_CRC16)
+                    {
+                        frameCheck = FrameCheckCrc16Update(frameCheck, nextByte);
+                    }
+                    else
+                    {
+                        frameCheck = FrameCheckByteAdd(frameCheck, nextByte, sentByteCount);
+                    }
+#else
+                    frameCheck = FrameCheckByteAdd(frameCheck, nextByte, sentByteCount);
+#endif
                 }
 
                 if ((nextByte == START_OF_PACKET_BYTE) || (nextByte == END_OF_PACKET_BYTE) || (nextByte == ESCAPE_BYTE))
@@ -342,6 +597,15 @@ com_adapter_result_t COM_FrameSet(uint8_t *responseBufferPtr, uint16_t responseL
         {
             // fail with no other actions
         }
+
+        if (isBaudRateChangePending)
+        {
+            // DataSend has waited for the last byte to shift out, so the new rate can be applied
+            isBaudRateChangePending = false;
+            activeBrgCount = pendingBrgCount;
+            SERCOM_BRGCountSet(activeBrgCount);
+            BaudFallbackTimerStart();
+        }
     }
 
     return processResult;
@@ -355,7 +619,21 @@ com_adapter_result_t COM_Initialize(uint16_t maximumBufferLength)
         MaxBufferLength = maximumBufferLength;
         isReceiveWindowOpen = false;
         isEscapedByte = false;
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+        frameCheckType = COM_FRAME_CHECK_CHECKSUM;
+#endif
         SERCOM_Initialize();
+        defaultBrgCount = SERCOM_BRGCountGet();
+        activeBrgCount = defaultBrgCount;
+        isBaudRateChangePending = false;
+        if (isBaudFallbackArmed == true)
+        {
+            BaudFallbackTimerStop();
+        }
+#if COM_AUTO_BAUD_ENABLED == 1
+        isAutoBaudConfirmed = false;
+        AutoBaudArm();
+#endif
         result = COM_PASS;
     }
     else
@@ -364,4 +642,35 @@ com_adapter_result_t COM_Initialize(uint16_t maximumBufferLength)
     }
 
     return result;
+}
+
+com_adapter_result_t COM_BaudRateSet(uint32_t baudRate)
+{
+    com_adapter_result_t result = COM_INVALID_ARG;
+
+    if (baudRate != 0U)
+    {
+        // Work out the closest count without touching the generator; it is only loaded once the response has been sent
+        uint32_t requestedBrgCount = SERCOM_BRGCountCalculate(baudRate);
+        uint32_t achievedBaudRate = SERCOM_BaudRateCalculate(requestedBrgCount);
+
+        uint32_t baudRateError = (achievedBaudRate > baudRate) ? (achievedBaudRate - baudRate) : (baudRate - achievedBaudRate);
+        if (baudRateError <= (baudRate / BAUD_RATE_ERROR_DIVISOR))
+        {
+            pendingBrgCount = requestedBrgCount;
+            isBaudRateChangePending = true;
+            result = COM_PASS;
+        }
+    }
+
+    return result;
+}
+
+void COM_Deinitialize(void)
+{
+    isReceiveWindowOpen = false;
+    if (isBaudFallbackArmed == true)
+    {
+        BaudFallbackTimerStop();
+    }
 }
\ No newline at end of file
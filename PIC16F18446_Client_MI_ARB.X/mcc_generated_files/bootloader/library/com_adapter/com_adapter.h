@@ -64,6 +64,46 @@
  */
 #define COM_FRAME_BYTE_COUNT (FRAME_CHECK_SIZE)
 
+/* cppcheck-suppress misra-c2012-2.5 */
+/**
+ * @ingroup com_adapter
+ * @def COM_FRAME_CHECK_CRC16_ENABLED
+ * Enables the CRC-16/CCITT frame check as an alternative to the additive checksum. Each frame is
+ * accepted if it validates as either check, and its response is sent with the same check, so the host
+ * selects the frame check per command and can return to the checksum at any time.
+ */
+#define COM_FRAME_CHECK_CRC16_ENABLED (1)
+
+/* cppcheck-suppress misra-c2012-2.5 */
+/**
+ * @ingroup com_adapter
+ * @def COM_BAUD_FALLBACK_TIMEOUT_MS
+ * Minimum time without a valid frame after a baud rate change before the adapter returns to the
+ * baud rate set by SERCOM_Initialize. The time is counted on Timer0, which the adapter uses only while
+ * a baud rate change is unconfirmed and leaves in its reset state otherwise. Range: 1 to 60000.
+ */
+#define COM_BAUD_FALLBACK_TIMEOUT_MS (1000U)
+
+/* cppcheck-suppress misra-c2012-2.5 */
+/**
+ * @ingroup com_adapter
+ * @def COM_AUTO_BAUD_ENABLED
+ * Enables the auto-baud entry phase. The host must send a 0x55 sync character before its first frame;
+ * SERCOM measures it and locks the baud rate generator to the host rate. Until a valid frame has been
+ * received, any receive error or failed frame arms the measurement again so the host can resend the sync
+ * character. Disabled by default because hosts that do not send the sync character cannot connect.
+ */
+#define COM_AUTO_BAUD_ENABLED (0)
+
+/* cppcheck-suppress misra-c2012-2.5 */
+/**
+ * @ingroup com_adapter
+ * @def COM_AUTO_BAUD_SYNC_BYTE
+ * Sync character measured by the auto-baud entry phase. Its alternating bits give the five rising edges the
+ * hardware needs.
+ */
+#define COM_AUTO_BAUD_SYNC_BYTE (0x55U)
+
 /**
  * @ingroup com_adapter
  * @enum com_adapter_result_t
@@ -94,6 +134,22 @@ typedef enum
     COM_SEND_COMPLETE = 0x7EU,
 } com_adapter_result_t;
 
+/**
+ * @ingroup com_adapter
+ * @enum com_frame_check_t
+ * @brief Contains the frame check types supported by the communication adapter. The values can be
+ * combined into a bit mask.
+ * @var com_frame_check_t: COM_FRAME_CHECK_CHECKSUM
+ * 0x01U - Inverted 16-bit additive checksum
+ * @var com_frame_check_t: COM_FRAME_CHECK_CRC16
+ * 0x02U - CRC-16/CCITT, polynomial 0x1021 with an initial value of 0xFFFF
+ */
+typedef enum
+{
+    COM_FRAME_CHECK_CHECKSUM = 0x01U,
+    COM_FRAME_CHECK_CRC16 = 0x02U,
+} com_frame_check_t;
+
 /**
  @ingroup com_adapter
  @brief Receives or sends bytes over SERCOM and pushes data bytes into the provided buffer until a complete frame is received.
@@ -126,4 +182,24 @@ com_adapter_result_t COM_FrameSet(uint8_t *responseBufferPtr, uint16_t responseL
  */
 com_adapter_result_t COM_Initialize(uint16_t maximumBufferLength);
 
+/**
+ @ingroup com_adapter
+ @brief Requests a new SERCOM baud rate. The rate is applied once the next frame, normally the
+ acknowledgment of the request, has been sent at the current rate. If no valid frame is received within
+ @ref COM_BAUD_FALLBACK_TIMEOUT_MS of the change, the adapter returns to the default baud rate.
+ @param [in] baudRate - Requested baud rate in bits per second
+ @return @ref COM_PASS - Baud rate can be generated within 2% and will be applied after the next frame \n
+ @return @ref COM_INVALID_ARG - Baud rate cannot be generated within 2% \n
+ */
+com_adapter_result_t COM_BaudRateSet(uint32_t baudRate);
+
+/**
+ @ingroup com_adapter
+ @brief Releases the peripherals borrowed by the communication adapter. This must be called before
+ control is handed over to the application so that the baud rate fallback timer is left in its reset state.
+ @param None.
+ @return None.
+ */
+void COM_Deinitialize(void);
+
 #endif //COM_ADAPTER_H
\ No newline at end of file
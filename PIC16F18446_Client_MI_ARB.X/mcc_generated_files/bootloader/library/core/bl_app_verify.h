@@ -34,6 +34,7 @@
 
 #include "bl_result_type.h"
 #include "bl_config.h"
+#include "../../../nvm/nvm.h"
 
 /**
  * @ingroup mdfu_client_8bit
@@ -47,6 +48,42 @@
  */
 bl_result_t BL_ImageVerify(void);
 
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Restarts the running CRC of the staging area. Called once the staging area has been erased.
+ * @param None.
+ * @return None.
+ */
+void BL_StagingCrcReset(void);
+
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Folds a freshly programmed staging area row into the running CRC by reading it back from flash.
+ * When rows arrive in address order, the next staging area verification only reads the final row instead of the
+ * whole partition. Rows may skip ahead over blank pages, which are folded in as erased words. Any backward or repeated
+ * write disables the running CRC until the next @ref BL_StagingCrcReset call.
+ * @param [in] address - Start address of the programmed row
+ * @param [in] length - Length of the programmed row in flash address units
+ * @return None.
+ */
+void BL_StagingCrcUpdate(flash_address_t address, flash_address_t length);
+
+#if BL_RANGE_CRC_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @brief Calculates the CRC-32 of a Flash range with the same algorithm used for image verification.
+ * Only answered once the core has been unlocked. The range must be page aligned, hold at least
+ * @ref BL_RANGE_CRC_MIN_PAGE_COUNT pages and lie inside the application image spaces.
+ * @param [in] startAddress - Start address of the range
+ * @param [in] length - Length of the range in flash address units
+ * @param [out] crc - CRC-32 of the range
+ * @return @ref BL_PASS - The CRC was calculated \n
+ * @return @ref BL_FAIL - The core is locked \n
+ * @return @ref BL_ERROR_ADDRESS_OUT_OF_RANGE - The range is not page aligned, too short or reaches outside the application image spaces \n
+ */
+bl_result_t BL_RangeCrcGet(uint32_t startAddress, uint32_t length, uint32_t * crc);
+#endif
+
 #if BL_APPLICATION_IMAGE_COUNT > 1
 /**
  * @ingroup mdfu_client_8bit
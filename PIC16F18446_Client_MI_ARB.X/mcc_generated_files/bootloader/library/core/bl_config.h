@@ -57,7 +57,7 @@
  * Represents the minor version of the image format that is
  * understood by the bootloader core. \n
  */
-#define BL_IMAGE_FORMAT_MINOR_VERSION (0x03) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#define BL_IMAGE_FORMAT_MINOR_VERSION (0x05) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_IMAGE_FORMAT_PATCH_VERSION
@@ -71,6 +71,15 @@
  * Indicates that the bootloader supports vectored interrupts in the application.
  */
 #define BL_VECTORED_INTERRUPTS_ENABLED (1) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_RESTORATION_FROM_BACKUP_ENABLED
+ * Defines whether a third image space holds a backup of the last valid execution image. The application memory
+ * after the bootloader is then split into three 0xAA0 word image spaces instead of two 0x1000 word image spaces.
+ * The backup is copied again only when a different image has been installed, and it is copied back into the
+ * execution image space when the execution image is not valid.
+ */
+#define BL_RESTORATION_FROM_BACKUP_ENABLED (0)
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_APPLICATION_START_ADDRESS
@@ -94,37 +103,230 @@
  * @def BL_APPLICATION_END_ADDRESS
  * End of the application memory space.
  */
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+#define BL_APPLICATION_END_ADDRESS (0x2A9F) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#else
 #define BL_APPLICATION_END_ADDRESS (0x2FFF) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#endif
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_IMAGE_PARTITION_SIZE
  * Defined size of the application memory space.
  */
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+#define BL_IMAGE_PARTITION_SIZE (0xAA0U) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#else
 #define BL_IMAGE_PARTITION_SIZE (0x1000U) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#endif
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_STAGING_IMAGE_START
  * Start of the application download space.
  */
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+#define BL_STAGING_IMAGE_START (0x2AA0) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#else
 #define BL_STAGING_IMAGE_START (0x3000) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#endif
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_STAGING_IMAGE_END
  * End of the application download space.
  */
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+#define BL_STAGING_IMAGE_END (0x353F)
+#else
 #define BL_STAGING_IMAGE_END (0x3FFF)
+#endif
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_STAGING_IMAGE_ID
  * Image area ID that identifies the download location of the transferred data.
  */
 #define BL_STAGING_IMAGE_ID (1U) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_BACKUP_IMAGE_ID
+ * Image area ID that identifies the backup of the execution image. It resides from address 0x3540 to address 0x3FDF.
+ */
+#define BL_BACKUP_IMAGE_ID (2U) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#endif
 /**
  * @ingroup mdfu_client_8bit
  * @def BL_APPLICATION_IMAGE_COUNT
  * Number of application image spaces configured.
  */
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+#define BL_APPLICATION_IMAGE_COUNT (3U)
+#else
 #define BL_APPLICATION_IMAGE_COUNT (2U)
+#endif
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_CRC32_TABLE_SIZE
+ * Selects the CRC-32 engine used for image verification. \n
+ * 0 - Bit-by-bit calculation. Smallest code size, eight shift/XOR steps per byte. \n
+ * 16 - 16-entry nibble lookup table (64 bytes of constant data), two lookups per byte. \n
+ * 256 - 256-entry byte lookup table (1 KB of constant data), one lookup per byte. Intended for larger parts. \n
+ * All options produce identical CRC values.
+ */
+#define BL_CRC32_TABLE_SIZE (16U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_LAZY_STAGING_ERASE_ENABLED
+ * Defines whether the staging area is erased page by page as the image is written instead of all at once
+ * when the bootloader is unlocked. The pages the image does not use are erased before the image state
+ * check or at the end of the transfer.
+ */
+#define BL_LAZY_STAGING_ERASE_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_FLASH_WRITE_COMPARE_ENABLED
+ * Defines whether a Flash page write first compares the page with the data to write. Identical pages are
+ * neither erased nor programmed, and blank pages are programmed without an erase.
+ */
+#define BL_FLASH_WRITE_COMPARE_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_WRITE_PAGE_COUNT
+ * Maximum number of contiguous Flash pages carried by one WRITE_FLASH block. The receive buffers grow by one
+ * page per packet buffer for every additional page. Image files must be built with blocks of at most this many
+ * pages, because the host splits the file by the advertised buffer size. The default of 1 keeps single-page
+ * image files working.
+ */
+#define BL_WRITE_PAGE_COUNT (1U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_COMPRESSED_WRITE_ENABLED
+ * Defines whether the core accepts compressed Flash data blocks. A compressed block packs the program words
+ * without their unused upper bits and replaces runs of erased words with a single token. It is decoded one
+ * page at a time into a page-sized RAM buffer. Compressed blocks were added in image format 0.4.0. Images
+ * built by pyfwimagebuilder are converted with tools/pack_image.py.
+ */
+#define BL_COMPRESSED_WRITE_ENABLED (0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_DELTA_WRITE_ENABLED
+ * Defines whether the core accepts delta Flash data blocks. A delta block rebuilds staging area pages from
+ * words copied out of the execution image space and literal words sent by the host, so an update only
+ * transfers what changed. It is decoded by the compressed block decoder, which must also be enabled. Delta
+ * blocks were added in image format 0.5.0. tools/pack_image.py builds them from two pyfwimagebuilder images,
+ * the update and the image running on the device.
+ */
+#define BL_DELTA_WRITE_ENABLED (0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_RANGE_CRC_ENABLED
+ * Defines whether the FTP answers CRC-32 requests over a host-selected range of the application image spaces.
+ * A host can then check the contents of a device without a transfer. The CRC of a range still tells the host
+ * something about the code in it, so the command is disabled by default, is only answered after an unlock block
+ * has been accepted and only covers whole pages.
+ */
+#define BL_RANGE_CRC_ENABLED (0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_RANGE_CRC_MIN_PAGE_COUNT
+ * Smallest range, in Flash pages, that a CRC-32 request may cover.
+ */
+#define BL_RANGE_CRC_MIN_PAGE_COUNT (8U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_INSTALLED_IMAGE_CHECK_ENABLED
+ * Defines whether a Start Transfer command may carry the footer of the image the host is about to send. When a
+ * valid image with the same version, verification range and CRC is already running, the client reports it and
+ * the host can skip the transfer.
+ */
+#define BL_INSTALLED_IMAGE_CHECK_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_RESUMABLE_TRANSFER_ENABLED
+ * Defines whether the core records its progress through a transfer in a reserved Flash row. When a Start Transfer
+ * command names the same image again, the staging area pages already written are kept and the host may resume
+ * from the first unwritten page. The final image verification still decides whether the transfer succeeded.
+ */
+#define BL_RESUMABLE_TRANSFER_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_TRANSFER_SESSION_ADDRESS
+ * Start of the Flash row that holds the transfer session record. The row is excluded from the
+ * project ROM ranges to keep it free.
+ */
+#define BL_TRANSFER_SESSION_ADDRESS (0x1FC0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_SESSION_CHECKPOINT_PAGES
+ * Number of contiguous staging area pages written between two checkpoints of the transfer session record.
+ * Each checkpoint programs two locations of the session row; a resumed transfer sends at most this many pages again.
+ */
+#define BL_SESSION_CHECKPOINT_PAGES (8U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_FOOTER_CACHE_ENABLED
+ * Defines whether the image manager keeps the footer of each image space in RAM after the first read.
+ * A cached footer is dropped whenever its Flash page is erased or written.
+ */
+#define BL_FOOTER_CACHE_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_VERIFIED_MARKER_ENABLED
+ * Defines whether a successful verification of the execution image space is recorded in Data EEPROM
+ * so that later boots can skip the CRC scan.
+ */
+#define BL_VERIFIED_MARKER_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_VERIFIED_MARKER_ADDRESS
+ * Data EEPROM address of the verified marker. The marker takes ten bytes and no program Flash.
+ */
+#define BL_VERIFIED_MARKER_ADDRESS (0xF000)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_FULL_VERIFY_INTERVAL
+ * Number of boots between full verifications of a marked execution image. \n
+ * 0 - Never force a full verification while the marker is valid. Nothing is written on those boots. \n
+ * N - Scan the image on every Nth boot, up to 255. Each boot in between rewrites the boot count byte of the marker
+ * in Data EEPROM.
+ */
+#define BL_FULL_VERIFY_INTERVAL (0U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_COPY_JOURNAL_ENABLED
+ * Defines whether an image copy records its progress in a reserved Flash row. A copy of the same image that was
+ * interrupted by a reset resumes at the first page group that was not completed instead of at the first page.
+ */
+#define BL_COPY_JOURNAL_ENABLED (1)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_COPY_JOURNAL_ADDRESS
+ * Start of the Flash row that holds the copy journal. The row is excluded from the project ROM ranges to keep it free.
+ */
+#define BL_COPY_JOURNAL_ADDRESS (0x1FA0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_COPY_JOURNAL_PAGES
+ * Number of pages copied between two marks of the copy journal. The group that was in progress when the copy
+ * was interrupted is copied again from its first page.
+ */
+#define BL_COPY_JOURNAL_PAGES (8U)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_SLOT_SWAP_ENABLED
+ * Defines whether an update is installed by running it from the slot it was downloaded to instead of copying it
+ * into the execution image space. The bootloader starts the newest valid image of IMAGE_0 and the staging area and
+ * downloads the next update into the other one. Every image must be linked for the slot it is sent to.
+ */
+#define BL_SLOT_SWAP_ENABLED (0)
+/**
+ * @ingroup mdfu_client_8bit
+ * @def BL_STAGING_INTERRUPT_VECTOR_LOW
+ * Start address of the low-priority interrupt vector of an image linked for the staging area.
+ */
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+#define BL_STAGING_INTERRUPT_VECTOR_LOW (0x2AA4) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#else
+#define BL_STAGING_INTERRUPT_VECTOR_LOW (0x3004) /* cppcheck-suppress misra-c2012-2.5; This is a false positive. */
+#endif
 
 /**
 * @ingroup mdfu_client_8bit
@@ -188,7 +390,10 @@
 typedef enum
 {
     IMAGE_0 = 0x00,
-    IMAGE_1
+    IMAGE_1,
+#if BL_RESTORATION_FROM_BACKUP_ENABLED == 1
+    IMAGE_2,
+#endif
 } bl_image_id_t;
 
 /**
@@ -34,6 +34,18 @@
 #include "bl_image_manager.h"
 #include "bl_config.h"
 #include "bl_memory.h"
+#if BL_SLOT_SWAP_ENABLED == 1
+#include "bl_interrupt.h"
+#endif
+
+#if BL_FOOTER_CACHE_ENABLED == 1
+static bl_footer_data_t footerCache[BL_APPLICATION_IMAGE_COUNT];
+static bool footerCacheIsValid[BL_APPLICATION_IMAGE_COUNT];
+// Flash reads avoided by serving footers from the cache since reset
+static uint32_t footerCacheSavedReadCount = 0U;
+#endif
+
+static bl_mem_result_t FooterFlashRead(uint8_t appId, bl_footer_data_t * footerData);
 
 flash_address_t BL_ApplicationStartAddressGet(uint8_t imageId)
 {
@@ -106,12 +118,83 @@ uint8_t BL_ApplicationExecutionIdGet(uint8_t imageId)
     return workFooterData.applicationId & 0xFF00;
 }
 
+#if BL_SLOT_SWAP_ENABLED == 1
+uint8_t BL_ApplicationActiveIdGet(void)
+{
+    return (stagingSlotIsActive == 1U) ? (uint8_t) BL_STAGING_IMAGE_ID : (uint8_t) IMAGE_0;
+}
+
+uint8_t BL_ApplicationStagingIdGet(void)
+{
+    return (stagingSlotIsActive == 1U) ? (uint8_t) IMAGE_0 : (uint8_t) BL_STAGING_IMAGE_ID;
+}
+
+void BL_ApplicationActiveIdSet(uint8_t imageId)
+{
+    stagingSlotIsActive = (imageId == (uint8_t) BL_STAGING_IMAGE_ID) ? 1U : 0U;
+}
+#endif
+
 bool BL_ApplicationIsVersionValid(uint32_t imageVersion)
 {
     return (imageVersion != 0xFFFFFFFF && imageVersion != 0x00000000);
 }
 
 bool BL_ApplicationFooterRead(uint8_t appId, bl_footer_data_t * footerData)
+{
+#if BL_FOOTER_CACHE_ENABLED == 1
+    bl_mem_result_t readResult = BL_MEM_FAIL;
+
+    if (appId >= BL_APPLICATION_IMAGE_COUNT)
+    {
+        readResult = FooterFlashRead(appId, footerData);
+    }
+    else if (footerCacheIsValid[appId] == true)
+    {
+        *footerData = footerCache[appId];
+        if (footerCacheSavedReadCount <= (UINT32_MAX - (uint32_t) sizeof (bl_footer_data_t)))
+        {
+            footerCacheSavedReadCount += (uint32_t) sizeof (bl_footer_data_t);
+        }
+        readResult = BL_MEM_PASS;
+    }
+    else
+    {
+        readResult = FooterFlashRead(appId, &footerCache[appId]);
+        footerCacheIsValid[appId] = (readResult == BL_MEM_PASS);
+        *footerData = footerCache[appId];
+    }
+    return (readResult == BL_MEM_PASS);
+#else
+    return (FooterFlashRead(appId, footerData) == BL_MEM_PASS);
+#endif
+}
+
+#if BL_FOOTER_CACHE_ENABLED == 1
+void BL_ApplicationFooterCacheInvalidate(flash_address_t address)
+{
+    flash_address_t pageStartAddress = FLASH_PageAddressGet(address);
+
+    for (uint8_t imageId = 0U; imageId < BL_APPLICATION_IMAGE_COUNT; imageId++)
+    {
+        flash_address_t footerStartAddress = BL_ApplicationFooterStartAddressGet(imageId);
+        flash_address_t footerEndAddress = footerStartAddress + (flash_address_t) (sizeof (bl_footer_data_t) - 1U);
+
+        // Drop the entry when the modified page holds any part of the footer
+        if ((pageStartAddress >= FLASH_PageAddressGet(footerStartAddress)) && (pageStartAddress <= FLASH_PageAddressGet(footerEndAddress)))
+        {
+            footerCacheIsValid[imageId] = false;
+        }
+    }
+}
+
+uint32_t BL_ApplicationFooterCacheSavedReadCountGet(void)
+{
+    return footerCacheSavedReadCount;
+}
+#endif
+
+static bl_mem_result_t FooterFlashRead(uint8_t appId, bl_footer_data_t * footerData)
 {
     flash_address_t footerAddressStart = BL_ApplicationFooterStartAddressGet(appId);
     bl_mem_result_t readResult = BL_MEM_FAIL;
@@ -168,6 +251,10 @@ bool BL_ApplicationRollbackCheck(uint8_t imageId)
     bool isTargetVersionNewer = false;
     // Read the id from the requested location which corresponds to the update slot the data should reside in
     uint8_t targetImageId = BL_ApplicationDownloadIdGet(imageId);
+#if BL_SLOT_SWAP_ENABLED == 1
+    // Images are not moved in slot swap mode; a new image competes with the one that is running
+    targetImageId = BL_ApplicationActiveIdGet();
+#endif
 
     // Perform check if the target location is different than the requested location
     if (targetImageId != imageId)
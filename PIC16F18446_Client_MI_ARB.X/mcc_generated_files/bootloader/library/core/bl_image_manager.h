@@ -74,6 +74,32 @@ uint8_t BL_ApplicationDownloadIdGet(uint8_t imageId);
 */
 uint8_t BL_ApplicationExecutionIdGet(uint8_t imageId);
 
+#if BL_SLOT_SWAP_ENABLED == 1
+/**
+* @ingroup bl_image_manager
+* @brief Retrieves the ID of the image space the application runs from in slot swap mode
+* @return uint8_t - IMAGE_0 or the staging area ID
+*/
+uint8_t BL_ApplicationActiveIdGet(void);
+
+/**
+* @ingroup bl_image_manager
+* @brief Retrieves the ID of the image space that receives the next download in slot swap mode.
+* This is whichever of IMAGE_0 and the staging area is not active.
+* @return uint8_t - IMAGE_0 or the staging area ID
+*/
+uint8_t BL_ApplicationStagingIdGet(void);
+
+/**
+* @ingroup bl_image_manager
+* @brief Selects the image space the application runs from in slot swap mode. The selection also routes the
+* application interrupts and is kept in RAM that survives the jump to the application.
+* @param [in] imageId - IMAGE_0 or the staging area ID
+* @return None.
+*/
+void BL_ApplicationActiveIdSet(uint8_t imageId);
+#endif
+
 /**
 * @ingroup bl_image_manager
 * @brief Validates the provided application version
@@ -93,6 +119,26 @@ bool BL_ApplicationIsVersionValid(uint32_t imageVersion);
 */
 bool BL_ApplicationFooterRead(uint8_t appId, bl_footer_data_t * footerData);
 
+#if BL_FOOTER_CACHE_ENABLED == 1
+/**
+* @ingroup bl_image_manager
+* @brief Drops the cached footer of every image space whose footer shares a page with the given address.
+* Must be called before any erase or write of a Flash page that may hold a footer.
+* @param [in] address - Any address inside the page being modified
+* @return None.
+*/
+void BL_ApplicationFooterCacheInvalidate(flash_address_t address);
+
+/**
+* @ingroup bl_image_manager
+* @brief Returns the number of Flash reads avoided by serving footers from the cache. Each cached footer read
+* saves one read per footer byte. The count starts at zero on reset and stops at UINT32_MAX.
+* @param None.
+* @return uint32_t - Number of Flash reads saved since reset
+*/
+uint32_t BL_ApplicationFooterCacheSavedReadCountGet(void);
+#endif
+
 #if BL_ANTI_ROLLBACK_ENABLED == 1
 /**
 * @ingroup bl_image_manager
@@ -30,6 +30,9 @@
 #include "bl_interrupt.h"
 
 volatile __persistent BL_INTERRUPT_FLAG_QUAL __bit bootloaderIsRunning __at(BL_INTERRUPT_FLAG_BIT_ADDRESS);
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+volatile __persistent BL_INTERRUPT_FLAG_QUAL __bit stagingSlotIsActive __at(BL_SLOT_FLAG_BIT_ADDRESS);
+#endif
 
 __asm("psect	intentry,class=CODE,delta=2");
 __asm("org 0x0"); //this is relative to the intentry psect address
@@ -45,7 +48,16 @@ __asm("BANKSEL(_bootloaderIsRunning/8)");
 //double jump would not be required and this would be slightly more optimal
 __asm("btfsc " ___mkstr(BANKMASK(_bootloaderIsRunning/8))",_bootloaderIsRunning&7");
 __asm("goto jmp_boothivec");
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+//both flags are in the same byte so the bank selected above still applies
+__asm("btfsc " ___mkstr(BANKMASK(_stagingSlotIsActive/8))",_stagingSlotIsActive&7");
+__asm("goto jmp_stagingvec");
+#endif
 __asm("ljmp " ___mkstr(BL_APPLICATION_INTERRUPT_VECTOR_LOW));
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_SLOT_SWAP_ENABLED == 1)
+__asm("jmp_stagingvec:");
+__asm("ljmp " ___mkstr(BL_STAGING_INTERRUPT_VECTOR_LOW));
+#endif
 __asm("jmp_boothivec:");
 __asm("asmopt pop");
 //bootloader interrupt code will automatically be linked here
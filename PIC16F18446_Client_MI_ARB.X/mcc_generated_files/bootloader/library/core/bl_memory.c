@@ -28,6 +28,9 @@
  */
 
 #include "bl_memory.h"
+#if BL_APPLICATION_IMAGE_COUNT > 1
+#include "bl_image_manager.h"
+#endif
 #include <string.h>
 
 /**@misradeviation{@advisory, 17.8} - The parameter is passed to this wrapper API to decrement and
@@ -47,6 +50,27 @@ static uint16_t rowWriteKey;
 /* cppcheck-suppress misra-c2012-8.9 */
 static flash_data_t writeBuffer[PROGMEM_PAGE_SIZE];
 
+#if defined(PIC_ARCH) && !defined(_PIC18)
+#define FLASH_DATA_MASK     ((flash_data_t) 0x3FFFU)
+#else
+#define FLASH_DATA_MASK     ((flash_data_t) 0xFFU)
+#endif
+#define FLASH_ERASED_VALUE  FLASH_DATA_MASK
+
+typedef enum
+{
+    FLASH_PAGE_DIFFERENT,
+    FLASH_PAGE_BLANK,
+    FLASH_PAGE_IDENTICAL
+} flash_page_state_t;
+
+#if BL_FLASH_WRITE_COMPARE_ENABLED == 1
+// Pages left untouched by BL_FlashWrite since reset
+static uint16_t skippedPageCount = 0U;
+
+static flash_page_state_t FlashPageCompare(flash_address_t pageStartAddress, const flash_data_t * pageData);
+#endif
+
 void BL_MemoryUnlockKeysInit(key_structure_t keys)
 {
     erasePageKey = keys.eraseUnlockKey;
@@ -225,39 +249,67 @@ bl_mem_result_t BL_FlashWrite(flash_address_t address, flash_data_t * buffer, si
         // Arguments appear to be valid. Begin writing
         NVM_StatusClear();
 
-        // Read the offset bytes into the work buffer starting at pageStartAddress
-        if (offsetByteCount > 0U)
+        // Source of the full page image that will be programmed
+        flash_data_t * pageData = writeBuffer;
+
+        if ((offsetByteCount == 0U) && (length == (size_t) PROGMEM_PAGE_SIZE))
         {
-            result = BL_FlashRead(pageStartAddress, &writeBuffer[0], offsetByteCount);
+            // The caller already holds the whole page; program it straight from the argument buffer
+            pageData = buffer;
+            result = BL_MEM_PASS;
         }
+        else
+        {
+            // Read the offset bytes into the work buffer starting at pageStartAddress
+            if (offsetByteCount > 0U)
+            {
+                result = BL_FlashRead(pageStartAddress, &writeBuffer[0], offsetByteCount);
+            }
 
-        // Copy the data to write from the argument buffer into the write buffer
+            // Copy the data to write from the argument buffer into the write buffer
 #ifndef _PIC18
-        // Copying data words
-        (void) memcpy(& writeBuffer[offsetByteCount], & buffer[0], length * 2U);
+            // Copying data words
+            (void) memcpy(& writeBuffer[offsetByteCount], & buffer[0], length * 2U);
 #else
-        // Copying data bytes
-        (void) memcpy(&writeBuffer[offsetByteCount], &buffer[0], length);
+            // Copying data bytes
+            (void) memcpy(&writeBuffer[offsetByteCount], &buffer[0], length);
 #endif
 
-        // Save the total amount of bytes stored so far
-        uint16_t loadedCount = (uint16_t) (offsetByteCount + length);
+            // Save the total amount of bytes stored so far
+            uint16_t loadedCount = (uint16_t) (offsetByteCount + length);
+
+            // Get the number of bytes that will need to be read after the target location.
+            uint16_t postReadByteCount = (uint16_t) (PROGMEM_PAGE_SIZE - loadedCount);
 
-        // Get the number of bytes that will need to be read after the target location.
-        uint16_t postReadByteCount = (uint16_t) (PROGMEM_PAGE_SIZE - loadedCount);
+            // If postReadByteCount is non-zero then read the rest of the page starting from the target address range
+            if (postReadByteCount > 0U)
+            {
+                result = BL_FlashRead((pageStartAddress + loadedCount), &writeBuffer[loadedCount], postReadByteCount);
+            }
+            else
+            {
+                // No pre-read is required
+                result = NVM_OK;
+            }
+        }
 
-        // If postReadByteCount is non-zero then read the rest of the page starting from the target address range
-        if (postReadByteCount > 0U)
+        flash_page_state_t pageState = FLASH_PAGE_DIFFERENT;
+#if BL_FLASH_WRITE_COMPARE_ENABLED == 1
+        if (BL_MEM_PASS == result)
         {
-            result = BL_FlashRead((pageStartAddress + loadedCount), &writeBuffer[loadedCount], postReadByteCount);
+            // Only erase and program what the page actually needs
+            pageState = FlashPageCompare(pageStartAddress, pageData);
         }
-        else
+#endif
+
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_FOOTER_CACHE_ENABLED == 1)
+        if ((BL_MEM_PASS == result) && (pageState != FLASH_PAGE_IDENTICAL))
         {
-            // No pre-read is required
-            result = NVM_OK;
+            BL_ApplicationFooterCacheInvalidate(pageStartAddress);
         }
+#endif
 
-        if (BL_MEM_PASS == result)
+        if ((BL_MEM_PASS == result) && (pageState == FLASH_PAGE_DIFFERENT))
         {
             // Perform the NVM erase and write sequence exactly how we did before.
             NVM_UnlockKeySet(erasePageKey);
@@ -269,13 +321,23 @@ bl_mem_result_t BL_FlashWrite(flash_address_t address, flash_data_t * buffer, si
             NVM_UnlockKeyClear();
         }
 
-        if (BL_MEM_PASS == result)
+        if ((BL_MEM_PASS == result) && (pageState != FLASH_PAGE_IDENTICAL))
         {
             // Write data to Flash row
             NVM_UnlockKeySet(rowWriteKey);
-            result = (bl_mem_result_t) FLASH_RowWrite(pageStartAddress, writeBuffer);
+            result = (bl_mem_result_t) FLASH_RowWrite(pageStartAddress, pageData);
             NVM_UnlockKeyClear();
         }
+        else if (BL_MEM_PASS == result)
+        {
+            // Flash already holds the requested data
+#if BL_FLASH_WRITE_COMPARE_ENABLED == 1
+            if (skippedPageCount != UINT16_MAX)
+            {
+                skippedPageCount++;
+            }
+#endif
+        }
         else
         {
             result = BL_MEM_FAIL;
@@ -293,6 +355,100 @@ bl_mem_result_t BL_FlashWrite(flash_address_t address, flash_data_t * buffer, si
     return result;
 }
 
+bool BL_FlashPageIsBlank(flash_address_t pageStartAddress)
+{
+    bool isBlank = true;
+
+    for (uint16_t index = 0U; (index < (uint16_t) PROGMEM_PAGE_SIZE) && (isBlank == true); index++)
+    {
+        NVM_UnlockKeySet(readKey);
+        isBlank = (FLASH_Read(pageStartAddress + index) == FLASH_ERASED_VALUE);
+        NVM_UnlockKeyClear();
+    }
+    return isBlank;
+}
+
+bl_mem_result_t BL_FlashPageErase(flash_address_t address)
+{
+    bl_mem_result_t result = BL_MEM_FAIL;
+    flash_address_t pageStartAddress = FLASH_PageAddressGet(address);
+
+    if (address >= PROGMEM_SIZE) // Check valid address
+    {
+        result = BL_MEM_INVALID_ARG;
+    }
+    else if (BL_FlashPageIsBlank(pageStartAddress) == true)
+    {
+        // Nothing to erase
+        result = BL_MEM_PASS;
+    }
+    else
+    {
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_FOOTER_CACHE_ENABLED == 1)
+        BL_ApplicationFooterCacheInvalidate(pageStartAddress);
+#endif
+        NVM_StatusClear();
+        NVM_UnlockKeySet(erasePageKey);
+        result = (bl_mem_result_t) FLASH_PageErase(pageStartAddress);
+        while (NVM_IsBusy() == true)
+        {
+
+        }
+        NVM_UnlockKeyClear();
+
+        if (BL_MEM_PASS != result)
+        {
+            result = BL_MEM_FAIL;
+        }
+    }
+    return result;
+}
+
+#if BL_FLASH_WRITE_COMPARE_ENABLED == 1
+static flash_page_state_t FlashPageCompare(flash_address_t pageStartAddress, const flash_data_t * pageData)
+{
+    bool isIdentical = true;
+    bool isBlank = true;
+    flash_page_state_t pageState = FLASH_PAGE_DIFFERENT;
+
+    // Stop reading as soon as the page can be neither skipped nor left unerased
+    for (uint16_t index = 0U; (index < (uint16_t) PROGMEM_PAGE_SIZE) && ((isIdentical == true) || (isBlank == true)); index++)
+    {
+        NVM_UnlockKeySet(readKey);
+        flash_data_t flashData = FLASH_Read(pageStartAddress + index);
+        NVM_UnlockKeyClear();
+
+        if (flashData != (pageData[index] & FLASH_DATA_MASK))
+        {
+            isIdentical = false;
+        }
+        if (flashData != FLASH_ERASED_VALUE)
+        {
+            isBlank = false;
+        }
+    }
+
+    if (isIdentical == true)
+    {
+        pageState = FLASH_PAGE_IDENTICAL;
+    }
+    else if (isBlank == true)
+    {
+        pageState = FLASH_PAGE_BLANK;
+    }
+    else
+    {
+        pageState = FLASH_PAGE_DIFFERENT;
+    }
+    return pageState;
+}
+
+uint16_t BL_FlashSkippedPageCountGet(void)
+{
+    return skippedPageCount;
+}
+#endif
+
 bl_mem_result_t BL_FlashCopy(flash_address_t srcAddress, flash_address_t destAddress, size_t length)
 {
     bl_mem_result_t result = BL_MEM_FAIL;
@@ -60,7 +60,15 @@
  * @def MAX_RESPONSE_SIZE
  * Length of the largest possible response in bytes.
  */
-#define MAX_RESPONSE_SIZE       (25U)
+#if (BL_RESUMABLE_TRANSFER_ENABLED == 1) && (COM_FRAME_CHECK_CRC16_ENABLED == 1)
+#define MAX_RESPONSE_SIZE       (41U)
+#elif BL_RESUMABLE_TRANSFER_ENABLED == 1
+#define MAX_RESPONSE_SIZE       (38U)
+#elif COM_FRAME_CHECK_CRC16_ENABLED == 1
+#define MAX_RESPONSE_SIZE       (27U)
+#else
+#define MAX_RESPONSE_SIZE       (24U)
+#endif
 /**
  * @ingroup mdfu_client_8bit_ftp
  * @def TLV_HEADER_SIZE
@@ -85,6 +93,15 @@
  * Number of buffers supported for reception.
  */
 #define PACKET_BUFFER_COUNT     (1U)
+/**
+ * @ingroup mdfu_client_8bit_ftp
+ * @def MIN_INTER_MESSAGE_DELAY_NS
+ * Minimum delay in nanoseconds that the host must wait between messages.
+ * WRITE_CHUNK erases and writes its row in one blocking call; only the staging area erase of Get Image State
+ * and End Transfer is split into one page per task call. Both finish before the response is sent, so the delay
+ * covers the work done after a response and before the next frame can be received.
+ */
+#define MIN_INTER_MESSAGE_DELAY_NS  (0x0016E360U) // 1,500,000 nanoseconds => 1.5 milliseconds
 /**
  * @ingroup mdfu_client_8bit_ftp
  * @def RETRY_TRANSFER_bm
@@ -128,6 +145,9 @@
  * Index of the file transfer data located inside the transfer buffer.
  */
 #define FILE_DATA_INDEX         (COMMAND_DATA_SIZE + SEQUENCE_DATA_SIZE)
+#define BAUD_RATE_DATA_SIZE     (4U)
+#define RANGE_CRC_DATA_SIZE     (8U)
+#define FOOTER_SUMMARY_DATA_SIZE (16U)
 
 /* cppcheck-suppress misra-c2012-2.3 */
 typedef enum
@@ -136,7 +156,9 @@ typedef enum
     FTP_START_TRANSFER = 0x02U,
     FTP_WRITE_CHUNK = 0x03U,
     FTP_GET_IMAGE_STATE = 0x04U,
-    FTP_END_TRANSFER = 0x05U
+    FTP_END_TRANSFER = 0x05U,
+    FTP_SET_BAUD_RATE = 0x06U,
+    FTP_GET_RANGE_CRC = 0x07U
 } ftp_command_t;
 
 typedef enum
@@ -181,6 +203,8 @@ typedef enum
     FTP_TRANSFER_PARAMETERS = 0x02U,
     FTP_TIMEOUT_INFO = 0x03U,
     FTP_MIN_INTER_MESSAGE_DELAY_INFO = 0x04U,
+    FTP_FRAME_CHECK_INFO = 0x05U,
+    FTP_TRANSFER_SESSION_INFO = 0x06U,
 } tlv_type_code_t;
 
 typedef struct
@@ -205,6 +229,8 @@ static uint8_t FTP_RETRY_BUFFER[MAX_RESPONSE_SIZE];
 
 static bool resetPending = false;
 static bool isComBusy = false;
+// The frame being executed waits on the NVM and runs again on the next task call
+static bool isCommandInProgress = false;
 
 static ftp_parser_helper_t ftpHelper = {
     .lastSequenceNumber = 0U,
@@ -228,8 +254,10 @@ static void ResponseSet(
                         uint16_t responsePayloadLength
                         );
 static void ClientInfoResponseSet(void);
+static void TransferStartResponseSet(void);
 static uint8_t TLVAppend(uint8_t * dataBufferStart, ftp_tlv_t * tlvData);
 static ftp_abort_code_t AbortCodeGet(bl_result_t targetStatus);
+static uint32_t CommandUint32Get(uint16_t dataIndex);
 
 bl_result_t FTP_Task(void)
 {
@@ -241,8 +269,16 @@ bl_result_t FTP_Task(void)
     ftp_transport_failure_code_t transportStatusResult = FTP_INTEGRITY_CHECK_ERROR;
     com_adapter_result_t comResult = COM_FAIL;
 
-    // Call the command to load the buffer up with the current receive count
-    comResult = COM_FrameTransfer((uint8_t *) & FTP_RECEIVE_BUFFER, &ftpReceiveCount);
+    if (true == isCommandInProgress)
+    {
+        // The buffer still holds the command waiting on the NVM, so nothing new is received until it completes
+        comResult = COM_PASS;
+    }
+    else
+    {
+        // Call the command to load the buffer up with the current receive count
+        comResult = COM_FrameTransfer((uint8_t *) & FTP_RECEIVE_BUFFER, &ftpReceiveCount);
+    }
 
     if (comResult == COM_BUFFER_ERROR)
     {
@@ -262,17 +298,23 @@ bl_result_t FTP_Task(void)
             ftpHelper.resendRequired = true;
             ResponseSet((uint8_t *) & FTP_RETRY_BUFFER, (uint8_t *) & transportStatusResult, FTP_COMMAND_NOT_EXECUTED, ftpHelper.nextSequenceNumber ^ RETRY_TRANSFER_bm, 1U);
         }
-        else if (SequenceNumberValidate())
+        else if ((true == isCommandInProgress) || SequenceNumberValidate())
         {
             // Call execution to handle the rest of the command processes
             processResult = OperationalBlockExecute();
-            ftpHelper.responseRequired = true;
+            // A command that is waiting on the NVM keeps its buffer and is answered once it completes
+            isCommandInProgress = (processResult == BL_BUSY);
+            ftpHelper.responseRequired = !isCommandInProgress;
         }
         else
         {
             processResult = BL_ERROR_FRAME_VALIDATION_FAIL;
         }
-        ParserDataReset();
+
+        if (false == isCommandInProgress)
+        {
+            ParserDataReset();
+        }
     }
     else if (comResult == COM_TRANSPORT_FAILURE)
     {
@@ -378,14 +420,40 @@ static bl_result_t OperationalBlockExecute(void)
         break;
 
     case FTP_GET_IMAGE_STATE:
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+        // Unused staging pages must be blank before they are covered by the CRC; they are erased one page per task call
+        processResult = BL_StagingAreaFinalizeTask();
+        if (processResult == BL_BUSY)
+        {
+            break;
+        }
+        if (processResult == BL_PASS)
+        {
+            processResult = BL_ImageVerify();
+        }
+#else
         processResult = BL_ImageVerify();
-        if (processResult == BL_ERROR_ROLLBACK_FAILURE)
+#endif
+        if (processResult == BL_FAIL)
+        {
+            // A staging page could not be erased
+            ftp_abort_code_t abortCode = AbortCodeGet(processResult);
+            ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, (uint8_t *) & abortCode, FTP_ABORT_TRANSFER, ftpHelper.currentSequenceNumber, 1U);
+        }
+        else if (processResult == BL_ERROR_ROLLBACK_FAILURE)
         {
             ftp_abort_code_t abortCode = FTP_APP_VERSION_ERROR;
             ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, (uint8_t *) & abortCode, FTP_ABORT_TRANSFER, ftpHelper.currentSequenceNumber, 1U);
         }
         else
         {
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+            if (processResult == BL_PASS)
+            {
+                // The transfer is complete; there is nothing left to resume
+                BL_TransferSessionClose();
+            }
+#endif
             ftp_image_state_t isImageValid = (processResult == BL_PASS) ? FTP_IMAGE_VALID : FTP_IMAGE_INVALID;
             ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, (uint8_t *) & isImageValid, FTP_COMMAND_SUCCESS, ftpHelper.currentSequenceNumber, 1U);
         }
@@ -393,12 +461,19 @@ static bl_result_t OperationalBlockExecute(void)
 
     case FTP_START_TRANSFER:
         processResult = BL_PASS;
-        (void) BL_Initialize();
-        ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, NULL, FTP_COMMAND_SUCCESS, ftpHelper.currentSequenceNumber, 0U);
+        TransferStartResponseSet();
         break;
 
     case FTP_WRITE_CHUNK:
-        processResult = BL_BootCommandProcess(&FTP_RECEIVE_BUFFER[FILE_DATA_INDEX], ftpReceiveCount);
+        if (ftpReceiveCount < (FILE_DATA_INDEX + COM_FRAME_BYTE_COUNT))
+        {
+            processResult = BL_ERROR_COMMAND_PROCESSING;
+        }
+        else
+        {
+            // Pass only the operational data, without the command, sequence and frame check bytes
+            processResult = BL_BootCommandProcess(&FTP_RECEIVE_BUFFER[FILE_DATA_INDEX], (uint16_t) (ftpReceiveCount - (FILE_DATA_INDEX + COM_FRAME_BYTE_COUNT)));
+        }
         if (processResult == BL_PASS)
         {
             ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, NULL, FTP_COMMAND_SUCCESS, ftpHelper.currentSequenceNumber, 0U);
@@ -411,6 +486,19 @@ static bl_result_t OperationalBlockExecute(void)
         break;
 
     case FTP_END_TRANSFER:
+#if BL_LAZY_STAGING_ERASE_ENABLED == 1
+        processResult = BL_StagingAreaFinalizeTask();
+        if (processResult == BL_BUSY)
+        {
+            break;
+        }
+        if (processResult == BL_FAIL)
+        {
+            ftp_abort_code_t abortCode = AbortCodeGet(processResult);
+            ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, (uint8_t *) & abortCode, FTP_ABORT_TRANSFER, ftpHelper.currentSequenceNumber, 1U);
+            break;
+        }
+#endif
         ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, NULL, FTP_COMMAND_SUCCESS, ftpHelper.currentSequenceNumber, 0U);
         resetPending = true;
 #ifdef MULTI_STAGE_RESPONSE
@@ -420,6 +508,61 @@ static bl_result_t OperationalBlockExecute(void)
         processResult = BL_PASS;
         break;
 
+    case FTP_SET_BAUD_RATE:
+        processResult = BL_ERROR_INVALID_ARGUMENTS;
+        if (ftpReceiveCount >= (FILE_DATA_INDEX + BAUD_RATE_DATA_SIZE + COM_FRAME_BYTE_COUNT))
+        {
+            // Little endian baud rate; the acknowledgment goes out at the current rate and the new one is used afterwards
+            uint32_t requestedBaudRate = CommandUint32Get(FILE_DATA_INDEX);
+
+            if (COM_BaudRateSet(requestedBaudRate) == COM_PASS)
+            {
+                processResult = BL_PASS;
+            }
+        }
+        if (processResult == BL_PASS)
+        {
+            ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, NULL, FTP_COMMAND_SUCCESS, ftpHelper.currentSequenceNumber, 0U);
+        }
+        else
+        {
+            // The rate cannot be generated from the device clock; keep the current one
+            ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, NULL, FTP_COMMAND_NOT_SUPPORTED, ftpHelper.currentSequenceNumber, 0U);
+        }
+        break;
+
+#if BL_RANGE_CRC_ENABLED == 1
+    case FTP_GET_RANGE_CRC:
+        processResult = BL_ERROR_ADDRESS_OUT_OF_RANGE;
+        if (ftpReceiveCount >= (FILE_DATA_INDEX + RANGE_CRC_DATA_SIZE + COM_FRAME_BYTE_COUNT))
+        {
+            // Little endian start address and length in flash address units
+            uint32_t rangeCrc = 0U;
+
+            processResult = BL_RangeCrcGet(
+                                           CommandUint32Get(FILE_DATA_INDEX),
+                                           CommandUint32Get(FILE_DATA_INDEX + 4U),
+                                           &rangeCrc
+                                           );
+            if (processResult == BL_PASS)
+            {
+                uint8_t crcData[4] = {
+                    (uint8_t) rangeCrc,
+                    (uint8_t) (rangeCrc >> 8),
+                    (uint8_t) (rangeCrc >> 16),
+                    (uint8_t) (rangeCrc >> 24)
+                };
+                ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, crcData, FTP_COMMAND_SUCCESS, ftpHelper.currentSequenceNumber, 4U);
+            }
+        }
+        if (processResult != BL_PASS)
+        {
+            ftp_abort_code_t abortCode = AbortCodeGet(processResult);
+            ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, (uint8_t *) & abortCode, FTP_ABORT_TRANSFER, ftpHelper.currentSequenceNumber, 1U);
+        }
+        break;
+#endif
+
     default:
         processResult = BL_ERROR_UNKNOWN_COMMAND;
         ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, NULL, FTP_COMMAND_NOT_SUPPORTED, ftpHelper.currentSequenceNumber, 0U);
@@ -429,6 +572,14 @@ static bl_result_t OperationalBlockExecute(void)
     return processResult;
 }
 
+static uint32_t CommandUint32Get(uint16_t dataIndex)
+{
+    return (uint32_t) FTP_RECEIVE_BUFFER[dataIndex]
+            | ((uint32_t) FTP_RECEIVE_BUFFER[dataIndex + 1U] << 8)
+            | ((uint32_t) FTP_RECEIVE_BUFFER[dataIndex + 2U] << 16)
+            | ((uint32_t) FTP_RECEIVE_BUFFER[dataIndex + 3U] << 24);
+}
+
 static ftp_abort_code_t AbortCodeGet(bl_result_t targetStatus)
 {
     ftp_abort_code_t abortCode = FTP_GENERIC_ERROR;
@@ -499,18 +650,76 @@ static uint8_t TLVAppend(uint8_t * dataBufferStart, ftp_tlv_t * tlvData)
     return tlvData->dataLength + TLV_HEADER_SIZE;
 }
 
+static void TransferStartResponseSet(void)
+{
+    ftp_image_state_t installedState = FTP_IMAGE_INVALID;
+    uint16_t startResponseLength = 0U;
+
+#if ((BL_APPLICATION_IMAGE_COUNT > 1) && (BL_INSTALLED_IMAGE_CHECK_ENABLED == 1)) || (BL_RESUMABLE_TRANSFER_ENABLED == 1)
+    // Little endian version, end address, start address and CRC, in the order they are stored in the footer
+    bool isFooterSummaryPresent = (ftpReceiveCount >= (FILE_DATA_INDEX + FOOTER_SUMMARY_DATA_SIZE + COM_FRAME_BYTE_COUNT));
+
+    if (isFooterSummaryPresent == true)
+    {
+        // Hosts that send the footer expect the image state in the response
+        startResponseLength = 1U;
+    }
+#endif
+#if (BL_APPLICATION_IMAGE_COUNT > 1) && (BL_INSTALLED_IMAGE_CHECK_ENABLED == 1)
+    if (isFooterSummaryPresent == true)
+    {
+        bl_footer_data_t footerData = {
+            .applicationId = 0U,
+            .applicationVersion = CommandUint32Get(FILE_DATA_INDEX),
+            .verificationEndAddress = CommandUint32Get(FILE_DATA_INDEX + 4U),
+            .verificationStartAddress = CommandUint32Get(FILE_DATA_INDEX + 8U),
+            .verificationData = CommandUint32Get(FILE_DATA_INDEX + 12U)
+        };
+
+        if (BL_ImageInstalledCheck(&footerData) == BL_PASS)
+        {
+            installedState = FTP_IMAGE_VALID;
+        }
+    }
+#endif
+    // The core is only reset for a transfer that will actually take place
+    if (installedState == FTP_IMAGE_INVALID)
+    {
+        (void) BL_Initialize();
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+        if (isFooterSummaryPresent == true)
+        {
+            // The footer identifies the image so that an interrupted transfer of it can be resumed
+            BL_TransferSessionOpen(CommandUint32Get(FILE_DATA_INDEX), CommandUint32Get(FILE_DATA_INDEX + 12U));
+        }
+#endif
+    }
+    ResponseSet((uint8_t *) & FTP_RESPONSE_BUFFER, (uint8_t *) & installedState, FTP_COMMAND_SUCCESS, ftpHelper.currentSequenceNumber, startResponseLength);
+}
+
 static void ClientInfoResponseSet(void)
 {
-    uint32_t minimumInterMessageDelayData = (uint32_t) 0x0016E360U; // 1,500,000 nanoseconds => 1.5 milliseconds
+    uint32_t minimumInterMessageDelayData = (uint32_t) MIN_INTER_MESSAGE_DELAY_NS;
     uint8_t numberOfTLVDataValues = 4U;
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+    // Bit mask of the frame checks the host may use; each response uses the frame check of its command
+    uint8_t frameCheckData = (uint8_t) COM_FRAME_CHECK_CHECKSUM | (uint8_t) COM_FRAME_CHECK_CRC16;
+
+    numberOfTLVDataValues++;
+#endif
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+    numberOfTLVDataValues++;
+#endif
 
     struct ftp_discovery_data_t
     {
         uint16_t maxPayloadSize;
         uint8_t numberOfPacketBuffers;
+        uint8_t writePageCount;
     } discoveryData = {
         .numberOfPacketBuffers = PACKET_BUFFER_COUNT,
-        .maxPayloadSize = (BL_MAX_BUFFER_SIZE)
+        .maxPayloadSize = (BL_MAX_BUFFER_SIZE),
+        .writePageCount = BL_WRITE_PAGE_COUNT
     };
 
     struct ftp_version_data_t
@@ -543,7 +752,12 @@ static void ClientInfoResponseSet(void)
 
     ftp_tlv_t ftpTransferParametersTLVData = {
         .dataType = FTP_TRANSFER_PARAMETERS,
+#if BL_WRITE_PAGE_COUNT > 1
+        // Only report the pages per block when it differs from the single page every host assumes
+        .dataLength = 0x04U,
+#else
         .dataLength = 0x03U,
+#endif
         .valueBuffer = (uint8_t *) & discoveryData
     };
 
@@ -558,6 +772,37 @@ static void ClientInfoResponseSet(void)
         .dataLength = 0x04U,
         .valueBuffer = (uint8_t *) & minimumInterMessageDelayData
     };
+
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+    ftp_tlv_t ftpFrameCheckTLVData = {
+        .dataType = FTP_FRAME_CHECK_INFO,
+        .dataLength = 0x01U,
+        .valueBuffer = & frameCheckData
+    };
+#endif
+
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+    struct ftp_transfer_session_info_t
+    {
+        uint32_t imageVersion;
+        uint32_t imageCrc;
+        uint32_t resumeAddress;
+    } transferSessionData = {
+        .imageVersion = 0U,
+        .imageCrc = 0U,
+        /* cppcheck-suppress misra-c2012-7.2; This rule cannot be followed due to assembly syntax requirements. */
+        .resumeAddress = (uint32_t) BL_APPLICATION_START_ADDRESS,
+    };
+
+    // A blank session row reports no identity and a transfer from the start of the image
+    (void) BL_TransferSessionGet(&transferSessionData.imageVersion, &transferSessionData.imageCrc, &transferSessionData.resumeAddress);
+
+    ftp_tlv_t ftpTransferSessionTLVData = {
+        .dataType = FTP_TRANSFER_SESSION_INFO,
+        .dataLength = 0x0CU,
+        .valueBuffer = (uint8_t *) & transferSessionData
+    };
+#endif
     // Calculate and set the response length
     ftpResponseLength = (
             ftpVersionTLVData.dataLength +
@@ -568,6 +813,12 @@ static void ClientInfoResponseSet(void)
             COMMAND_DATA_SIZE +
             (TLV_HEADER_SIZE * numberOfTLVDataValues)
             );
+#if COM_FRAME_CHECK_CRC16_ENABLED == 1
+    ftpResponseLength += ftpFrameCheckTLVData.dataLength;
+#endif
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+    ftpResponseLength += ftpTransferSessionTLVData.dataLength;
+#endif
 
     // Update The Sequence Value
     FTP_RESPONSE_BUFFER[SEQUENCE_BYTE_INDEX] = ftpHelper.currentSequenceNumber;
@@ -581,9 +832,25 @@ static void ClientInfoResponseSet(void)
     fileDataOffset += TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpVersionTLVData);
     fileDataOffset += TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpTransferParametersTLVData);
     fileDataOffset += TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpTimeoutTLVData);
+#if (COM_FRAME_CHECK_CRC16_ENABLED == 1) || (BL_RESUMABLE_TRANSFER_ENABLED == 1)
+    fileDataOffset += TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpMinInterMessageDelayTLVData);
+#if (COM_FRAME_CHECK_CRC16_ENABLED == 1) && (BL_RESUMABLE_TRANSFER_ENABLED == 1)
+    fileDataOffset += TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpFrameCheckTLVData);
+#elif COM_FRAME_CHECK_CRC16_ENABLED == 1
+
+    // drop the length of the last TLV append command because it is not needed
+    (void) TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpFrameCheckTLVData);
+#endif
+#if BL_RESUMABLE_TRANSFER_ENABLED == 1
+
+    // drop the length of the last TLV append command because it is not needed
+    (void) TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpTransferSessionTLVData);
+#endif
+#else
 
     // drop the length of the last TLV append command because it is not needed
     (void) TLVAppend(&(FTP_RESPONSE_BUFFER[fileDataOffset]), &ftpMinInterMessageDelayTLVData);
+#endif
 }
 
 bl_result_t FTP_Initialize(void)
@@ -592,5 +859,12 @@ bl_result_t FTP_Initialize(void)
     com_adapter_result_t comInitStatus = COM_Initialize(MAX_TRANSFER_SIZE);
     isComBusy = false;
     resetPending = false;
+    isCommandInProgress = false;
     return (comInitStatus == COM_PASS) ? BL_PASS : BL_FAIL;
+}
+
+void FTP_Deinitialize(void)
+{
+    // Release the communication layer so the application starts with the peripherals it borrowed in reset state
+    COM_Deinitialize();
 }
\ No newline at end of file
@@ -66,4 +66,12 @@ bl_result_t FTP_Task(void);
  */
 bl_result_t FTP_Initialize(void);
 
+/**
+ * @ingroup mdfu_client_8bit_ftp
+ * @brief Stops the FTP and dependant layers. Must be called before the application is started.
+ * @param None.
+ * @return None.
+ */
+void FTP_Deinitialize(void);
+
 #endif // BL_FTP_H
\ No newline at end of file
@@ -50,6 +50,20 @@
  */
 #define PROGMEM_SIZE         (0x4000U)
 
+/**
+ * @ingroup nvm_driver
+ * @def EEPROM_START_ADDRESS
+ * Contains the starting address of EEPROM.
+ */
+#define EEPROM_START_ADDRESS (0xF000U)
+
+/**
+ * @ingroup nvm_driver
+ * @def EEPROM_SIZE
+ * Contains the size of EEPROM in bytes.
+ */
+#define EEPROM_SIZE          (256U)
+
 /**
  * @ingroup nvm_driver
  * @def UNLOCK_KEY
@@ -79,6 +93,17 @@ typedef uint16_t device_id_data_t; //Device ID data size is 14-bit. Two most sig
  */
 typedef uint16_t device_id_address_t;
 
+/**
+ * @ingroup nvm_driver
+ * @brief Data type for the EEPROM data.
+ */
+typedef uint8_t eeprom_data_t;
+/**
+ * @ingroup nvm_driver
+ * @brief Data type for the EEPROM address.
+ */
+typedef uint16_t eeprom_address_t;
+
 /**
  * @ingroup nvm_driver
  * @enum nvm_status_t
@@ -192,6 +217,26 @@ uint16_t FLASH_PageOffsetGet(flash_address_t address);
 #define FLASH_ErasePageAddressGet FLASH_PageAddressGet
 #define FLASH_ErasePageOffsetGet FLASH_PageOffsetGet
 
+/**
+ * @ingroup nvm_driver
+ * @brief Reads one byte from the given EEPROM address.
+ * @param [in] address - Address of the EEPROM location from which data is to be read.
+ * @return EEPROM data byte read from the given EEPROM address.
+ */
+eeprom_data_t EEPROM_Read(eeprom_address_t address);
+
+/**
+ * @ingroup nvm_driver
+ * @brief Writes one byte to the given EEPROM address. The byte is erased by the write itself.
+ * @pre Set the unlock key using the @ref NVM_UnlockKeySet() API, if the key has been cleared before.
+ *      AoU: **Address Qualifiers** must be configured to **Require** under *Project Properties>XC8 Compiler>Optimizations*.
+ * @post Poll @ref NVM_IsBusy() until the write completes before the next NVM operation.
+ * @param [in] address - Address of the EEPROM location to be written.
+ * @param [in] data - EEPROM data byte to be written.
+ * @return None.
+ */
+void EEPROM_Write(eeprom_address_t address, eeprom_data_t data);
+
 /**
  * @ingroup nvm_driver
  * @brief Reads the Device ID.
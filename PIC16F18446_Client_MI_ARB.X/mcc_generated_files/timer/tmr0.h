@@ -0,0 +1,112 @@
+/**
+ * TMR0 Generated Driver API Header File
+ * 
+ * @file tmr0.h
+ * 
+ * @defgroup tmr0 TMR0
+ * 
+ * @brief This file contains API prototypes and other datatypes for the Timer0 (TMR0) module.
+ *
+ * @version TMR0 Driver Version 3.0.0
+*/
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+#ifndef TMR0_H
+#define TMR0_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @ingroup tmr0
+ * @def TMR0_CLOCK_FREQUENCY
+ * Timer0 count rate in Hz: the 31 kHz LFINTOSC divided by the 1:32 prescaler.
+ */
+#define TMR0_CLOCK_FREQUENCY (968U)
+
+/**
+ * @ingroup tmr0
+ * @brief Configures Timer0 as a 16-bit counter clocked asynchronously from the LFINTOSC through a 1:32 prescaler.
+ * The timer is left stopped with the overflow flag cleared.
+ * @param None.
+ * @return None.
+ */
+void TMR0_Initialize(void);
+
+/**
+ * @ingroup tmr0
+ * @brief Stops Timer0 and returns its registers to their Reset values.
+ * @param None.
+ * @return None.
+ */
+void TMR0_Deinitialize(void);
+
+/**
+ * @ingroup tmr0
+ * @brief Starts Timer0.
+ * @param None.
+ * @return None.
+ */
+void TMR0_Start(void);
+
+/**
+ * @ingroup tmr0
+ * @brief Stops Timer0.
+ * @param None.
+ * @return None.
+ */
+void TMR0_Stop(void);
+
+/**
+ * @ingroup tmr0
+ * @brief Returns the current 16-bit Timer0 count.
+ * @param None.
+ * @return uint16_t - Value held in TMR0H:TMR0L.
+ */
+uint16_t TMR0_CounterGet(void);
+
+/**
+ * @ingroup tmr0
+ * @brief Loads the 16-bit Timer0 count. The timer overflows after 65536 - counterValue counts.
+ * @param uint16_t counterValue - Value loaded into TMR0H:TMR0L.
+ * @return None.
+ */
+void TMR0_CounterSet(uint16_t counterValue);
+
+/**
+ * @ingroup tmr0
+ * @brief Returns the latched Timer0 overflow flag.
+ * @param None.
+ * @retval True - Timer0 has overflowed since the flag was last cleared
+ * @retval False - No overflow has occurred
+ */
+bool TMR0_OverflowStatusGet(void);
+
+/**
+ * @ingroup tmr0
+ * @brief Clears the Timer0 overflow flag.
+ * @param None.
+ * @return None.
+ */
+void TMR0_OverflowStatusClear(void);
+
+#endif // TMR0_H
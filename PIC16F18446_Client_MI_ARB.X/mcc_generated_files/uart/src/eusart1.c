@@ -56,10 +56,10 @@ const uart_drv_interface_t SERCOM = {
     .TransmitDisable = &EUSART1_TransmitDisable,
     .AutoBaudSet = &EUSART1_AutoBaudSet,
     .AutoBaudQuery = &EUSART1_AutoBaudQuery,
-    .BRGCountSet = NULL,
-    .BRGCountGet = NULL,
-    .BaudRateSet = NULL,
-    .BaudRateGet = NULL,
+    .BRGCountSet = &EUSART1_BRGCountSet,
+    .BRGCountGet = &EUSART1_BRGCountGet,
+    .BaudRateSet = &EUSART1_BaudRateSet,
+    .BaudRateGet = &EUSART1_BaudRateGet,
     .AutoBaudEventEnableGet = NULL,
     .ErrorGet = &EUSART1_ErrorGet,
     .TxCompleteCallbackRegister = NULL,
@@ -195,6 +195,48 @@ void EUSART1_AutoBaudDetectOverflowReset(void)
     BAUD1CONbits.ABDOVF = 0; 
 }
 
+void EUSART1_BRGCountSet(uint32_t brgValue)
+{
+    SP1BRGL = (uint8_t)(brgValue & 0xFFU);
+    SP1BRGH = (uint8_t)((brgValue >> 8) & 0xFFU);
+}
+
+uint32_t EUSART1_BRGCountGet(void)
+{
+    return (((uint32_t)SP1BRGH << 8) | (uint32_t)SP1BRGL);
+}
+
+uint32_t EUSART1_BRGCountCalculate(uint32_t baudRate)
+{
+    uint32_t brgValue = 0U;
+
+    // BRG16 = 1 and BRGH = 1: baud rate = _XTAL_FREQ / (4 * (SP1BRG + 1)), rounded to the nearest count
+    if ((baudRate != 0U) && (baudRate <= ((uint32_t)_XTAL_FREQ / 4U)))
+    {
+        brgValue = ((((uint32_t)_XTAL_FREQ / 4U) + (baudRate / 2U)) / baudRate) - 1U;
+    }
+    if (brgValue > 0xFFFFU)
+    {
+        brgValue = 0xFFFFU;
+    }
+    return brgValue;
+}
+
+uint32_t EUSART1_BaudRateCalculate(uint32_t brgValue)
+{
+    return (((uint32_t)_XTAL_FREQ / 4U) / (brgValue + 1U));
+}
+
+void EUSART1_BaudRateSet(uint32_t baudRate)
+{
+    EUSART1_BRGCountSet(EUSART1_BRGCountCalculate(baudRate));
+}
+
+uint32_t EUSART1_BaudRateGet(void)
+{
+    return EUSART1_BaudRateCalculate(EUSART1_BRGCountGet());
+}
+
 bool EUSART1_IsRxReady(void)
 {
     return (bool)(PIR3bits.RC1IF);
@@ -0,0 +1,257 @@
+/*
+ * Runs the frame parsing and frame check code of the communication adapter against the
+ * fake SERCOM in fake_eusart.c. Frames are built here with the checksum or the CRC-16
+ * frame check the host uses, pushed into the receive queue and read back with
+ * COM_FrameTransfer. Responses sent with COM_FrameSet are decoded from the transmit
+ * queue.
+ *
+ * Usage: com_adapter_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "com_adapter.h"
+#include "fake_eusart.h"
+
+#define BUFFER_SIZE             (100U)
+#define DEFAULT_BRG_COUNT       (0x44UL)
+
+static uint8_t receiveBuffer[BUFFER_SIZE];
+static uint16_t receiveIndex;
+static unsigned int failureCount;
+
+static void Check(bool condition, const char * description)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", description);
+        failureCount++;
+    }
+}
+
+static uint16_t ChecksumGet(const uint8_t * data, uint16_t length)
+{
+    uint16_t checksum = 0U;
+
+    for (uint16_t index = 0U; index < length; index++)
+    {
+        checksum += ((index & 1U) == 0U) ? data[index] : (uint16_t) (data[index] << 8U);
+    }
+    return (uint16_t) ~checksum;
+}
+
+static uint16_t Crc16Get(const uint8_t * data, uint16_t length)
+{
+    uint16_t crc = 0xFFFFU;
+
+    for (uint16_t index = 0U; index < length; index++)
+    {
+        crc ^= (uint16_t) (data[index] << 8U);
+        for (uint8_t bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t) ((crc << 1U) ^ 0x1021U) : (uint16_t) (crc << 1U);
+        }
+    }
+    return crc;
+}
+
+static void ByteQueue(uint8_t data)
+{
+    testRxQueue[testRxHead++] = data;
+}
+
+static void FrameQueue(const uint8_t * data, uint16_t length, uint16_t frameCheck)
+{
+    uint8_t frame[BUFFER_SIZE + 2U];
+
+    (void) memcpy(frame, data, length);
+    frame[length] = (uint8_t) frameCheck;
+    frame[length + 1U] = (uint8_t) (frameCheck >> 8U);
+
+    ByteQueue(0x56U);
+    for (uint16_t index = 0U; index < (length + 2U); index++)
+    {
+        if ((frame[index] == 0x56U) || (frame[index] == 0x9EU) || (frame[index] == 0xCCU))
+        {
+            ByteQueue(0xCCU);
+            ByteQueue((uint8_t) ~frame[index]);
+        }
+        else
+        {
+            ByteQueue(frame[index]);
+        }
+    }
+    ByteQueue(0x9EU);
+}
+
+// Decodes the transmitted frame and returns its length, frame check included
+static uint16_t ResponseDecode(uint8_t * data)
+{
+    uint16_t length = 0U;
+
+    if ((testTxCount < 2U) || (testTxQueue[0] != 0x56U) || (testTxQueue[testTxCount - 1U] != 0x9EU))
+    {
+        return 0U;
+    }
+    for (uint16_t index = 1U; index < (testTxCount - 1U); index++)
+    {
+        if (testTxQueue[index] == 0xCCU)
+        {
+            index++;
+            data[length] = (uint8_t) ~testTxQueue[index];
+        }
+        else
+        {
+            data[length] = testTxQueue[index];
+        }
+        length++;
+    }
+    return length;
+}
+
+static com_adapter_result_t FrameReceive(void)
+{
+    receiveIndex = 0U;
+    return COM_FrameTransfer(receiveBuffer, &receiveIndex);
+}
+
+static void ChecksumFramesTest(void)
+{
+    const uint8_t specialFrame[] = {0x81U, 0x01U, 0x56U, 0x9EU, 0xCCU, 0x05U};
+    const uint8_t shortFrame[] = {0x02U, 0x03U, 0x07U};
+    uint8_t response[BUFFER_SIZE];
+
+    // Two frames arrive back to back; the second one stays queued for the next call
+    FrameQueue(specialFrame, sizeof (specialFrame), ChecksumGet(specialFrame, sizeof (specialFrame)));
+    FrameQueue(shortFrame, sizeof (shortFrame), ChecksumGet(shortFrame, sizeof (shortFrame)));
+    Check(FrameReceive() == COM_PASS, "checksum frame with escaped bytes is accepted");
+    Check((receiveIndex == (sizeof (specialFrame) + 2U)) && (memcmp(receiveBuffer, specialFrame, sizeof (specialFrame)) == 0),
+          "escaped bytes are restored");
+    Check((FrameReceive() == COM_PASS) && (receiveIndex == (sizeof (shortFrame) + 2U)), "queued frame is accepted");
+    Check(FrameReceive() == COM_FAIL, "an empty receive queue gives no frame");
+
+    // The response uses the checksum as well
+    testTxCount = 0U;
+    Check(COM_FrameSet((uint8_t *) specialFrame, sizeof (specialFrame)) == COM_PASS, "checksum response is sent");
+    Check((ResponseDecode(response) == (sizeof (specialFrame) + 2U)) && (memcmp(response, specialFrame, sizeof (specialFrame)) == 0)
+          && ((response[6] | (response[7] << 8U)) == ChecksumGet(specialFrame, sizeof (specialFrame))),
+          "checksum response carries the payload and its checksum");
+}
+
+static void RejectedFramesTest(void)
+{
+    const uint8_t frame[] = {0x01U, 0x02U, 0x03U, 0x04U, 0x05U};
+
+    FrameQueue(frame, sizeof (frame), ChecksumGet(frame, sizeof (frame)));
+    testRxQueue[testRxHead - 4U] ^= 0x10U;
+    Check(FrameReceive() == COM_TRANSPORT_FAILURE, "corrupted frame is rejected");
+
+    ByteQueue(0x56U);
+    ByteQueue(0x01U);
+    ByteQueue(0x9EU);
+    Check(FrameReceive() == COM_TRANSPORT_FAILURE, "frame without a frame check is rejected");
+
+    ByteQueue(0x01U);
+    ByteQueue(0x9EU);
+    Check(FrameReceive() == COM_FAIL, "bytes outside a frame are dropped");
+
+    // A framing error on a payload byte loses that byte and resets the UART
+    FrameQueue(frame, sizeof (frame), ChecksumGet(frame, sizeof (frame)));
+    testRxErrorIndex = testRxTail + 3U;
+    Check(FrameReceive() == COM_TRANSPORT_FAILURE, "frame with a receive error is rejected");
+    testRxErrorIndex = TEST_NO_ERROR;
+    FrameQueue(frame, sizeof (frame), ChecksumGet(frame, sizeof (frame)));
+    Check(FrameReceive() == COM_PASS, "frame after a receive error is accepted");
+}
+
+static void Crc16FramesTest(void)
+{
+    const uint8_t frame[] = {0x80U, 0x02U, 0x11U, 0x56U, 0x22U};
+    const uint8_t checksumFrame[] = {0x02U, 0x03U, 0x07U};
+    uint8_t response[BUFFER_SIZE];
+
+    Check(Crc16Get((const uint8_t *) "123456789", 9U) == 0x29B1U, "reference CRC-16/CCITT-FALSE check value");
+
+    FrameQueue(frame, sizeof (frame), Crc16Get(frame, sizeof (frame)));
+    Check((FrameReceive() == COM_PASS) && (receiveIndex == (sizeof (frame) + 2U)), "CRC-16 frame is accepted");
+
+    testTxCount = 0U;
+    Check(COM_FrameSet((uint8_t *) frame, sizeof (frame)) == COM_PASS, "CRC-16 response is sent");
+    Check((ResponseDecode(response) == (sizeof (frame) + 2U))
+          && ((response[5] | (response[6] << 8U)) == Crc16Get(frame, sizeof (frame))),
+          "CRC-16 frame is answered with CRC-16");
+
+    // The host can fall back to the checksum at any time
+    FrameQueue(checksumFrame, sizeof (checksumFrame), ChecksumGet(checksumFrame, sizeof (checksumFrame)));
+    Check(FrameReceive() == COM_PASS, "checksum frame after a CRC-16 frame is accepted");
+    testTxCount = 0U;
+    Check(COM_FrameSet((uint8_t *) checksumFrame, sizeof (checksumFrame)) == COM_PASS, "checksum response is sent");
+    Check((ResponseDecode(response) == (sizeof (checksumFrame) + 2U))
+          && ((response[3] | (response[4] << 8U)) == ChecksumGet(checksumFrame, sizeof (checksumFrame))),
+          "checksum frame is answered with the checksum");
+}
+
+static void OverflowTest(void)
+{
+    const uint8_t frame[] = {0x01U, 0x02U, 0x03U, 0x04U};
+
+    Check(COM_Initialize(4U) == COM_PASS, "adapter initializes with a short buffer");
+    FrameQueue(frame, sizeof (frame), ChecksumGet(frame, sizeof (frame)));
+    Check(FrameReceive() == COM_BUFFER_ERROR, "frame longer than the buffer is rejected");
+    // The rest of the frame is dropped
+    Check(FrameReceive() == COM_FAIL, "bytes after an overflow are dropped");
+    Check(COM_Initialize(BUFFER_SIZE) == COM_PASS, "adapter initializes");
+}
+
+static void BaudRateTest(void)
+{
+    const uint8_t frame[] = {0x02U, 0x03U, 0x07U};
+
+    Check(COM_BaudRateSet(12345678UL) == COM_INVALID_ARG, "unreachable baud rate is refused");
+    Check(COM_BaudRateSet(500000UL) == COM_PASS, "baud rate change is accepted");
+    Check(EUSART1_BRGCountGet() == DEFAULT_BRG_COUNT, "baud rate is kept until the response is sent");
+    testTxCount = 0U;
+    (void) COM_FrameSet((uint8_t *) frame, sizeof (frame));
+    Check(EUSART1_BRGCountGet() == 15UL, "baud rate changes after the response");
+
+    // A receive error keeps the new rate
+    FrameQueue(frame, sizeof (frame), ChecksumGet(frame, sizeof (frame)));
+    testRxErrorIndex = testRxTail + 1U;
+    (void) FrameReceive();
+    testRxErrorIndex = TEST_NO_ERROR;
+    Check(EUSART1_BRGCountGet() == 15UL, "UART reset keeps the new baud rate");
+
+    // The host never sends a frame at the new rate
+    testTimerOverflow = true;
+    (void) FrameReceive();
+    Check(EUSART1_BRGCountGet() == DEFAULT_BRG_COUNT, "baud rate falls back when no frame arrives");
+
+    Check(COM_BaudRateSet(500000UL) == COM_PASS, "baud rate change is accepted again");
+    (void) COM_FrameSet((uint8_t *) frame, sizeof (frame));
+    FrameQueue(frame, sizeof (frame), ChecksumGet(frame, sizeof (frame)));
+    Check(FrameReceive() == COM_PASS, "frame at the new baud rate is accepted");
+    testTimerOverflow = true;
+    (void) FrameReceive();
+    Check(EUSART1_BRGCountGet() == 15UL, "confirmed baud rate stays");
+}
+
+int main(void)
+{
+    Check(COM_Initialize(0U) == COM_INVALID_ARG, "zero buffer length is refused");
+    Check(COM_Initialize(BUFFER_SIZE) == COM_PASS, "adapter initializes");
+
+    ChecksumFramesTest();
+    RejectedFramesTest();
+    Crc16FramesTest();
+    OverflowTest();
+    BaudRateTest();
+
+    if (failureCount != 0U)
+    {
+        fprintf(stderr, "%u checks failed\n", failureCount);
+        return EXIT_FAILURE;
+    }
+    printf("frame checks pass\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/*
+ * Programs the pages of an image file straight into the execution image space and times
+ * BL_ImageVerifyById over it with the CRC-32 engine selected by BL_CRC32_TABLE_SIZE. The
+ * image footer holds the CRC-32 computed by pyfwimagebuilder, so every engine must
+ * verify the image to pass. The Makefile builds one binary per engine.
+ *
+ * Usage: crc32_benchmark <image.img>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "bl_core.h"
+#include "bl_app_verify.h"
+#include "bl_image_manager.h"
+
+#define IMAGE_SIZE_MAX          (0x10000U)
+#define VERIFY_COUNT            (200U)
+#define WRITE_FLASH_BLOCK       (0x02U)
+
+extern flash_data_t testFlash[PROGMEM_SIZE];
+
+static uint8_t imageData[IMAGE_SIZE_MAX];
+
+static int ImageProgram(const char * path)
+{
+    FILE * imageFile = fopen(path, "rb");
+    size_t imageSize = 0U;
+    size_t index = 0U;
+
+    if (imageFile == NULL)
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return -1;
+    }
+    imageSize = fread(imageData, 1U, sizeof (imageData), imageFile);
+    (void) fclose(imageFile);
+
+    while ((index + BL_BLOCK_HEADER_SIZE) <= imageSize)
+    {
+        uint16_t blockLength = (uint16_t) (imageData[index] | (imageData[index + 1U] << 8U));
+
+        if ((blockLength < BL_BLOCK_HEADER_SIZE) || ((index + blockLength) > imageSize))
+        {
+            fprintf(stderr, "%s: malformed block at offset 0x%zx\n", path, index);
+            return -1;
+        }
+        if ((imageData[index + 2U] == WRITE_FLASH_BLOCK) && (blockLength >= (BL_BLOCK_HEADER_SIZE + BL_COMMAND_HEADER_SIZE)))
+        {
+            const uint8_t * header = &imageData[index + BL_BLOCK_HEADER_SIZE];
+            flash_address_t address = (flash_address_t) (header[0] | (header[1] << 8U) | ((uint32_t) header[2] << 16U));
+            uint16_t wordCount = (blockLength - (BL_BLOCK_HEADER_SIZE + BL_COMMAND_HEADER_SIZE)) / 2U;
+
+            for (uint16_t word = 0U; word < wordCount; word++)
+            {
+                const uint8_t * data = &header[BL_COMMAND_HEADER_SIZE + (2U * word)];
+                testFlash[(address + word) % PROGMEM_SIZE] = (flash_data_t) ((data[0] | (data[1] << 8U)) & 0x3FFFU);
+            }
+        }
+        index += blockLength;
+    }
+    return 0;
+}
+
+int main(int argc, char ** argv)
+{
+    bl_footer_data_t footerData;
+    clock_t startTime;
+    double elapsedTime;
+    uint32_t byteCount;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <image.img>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    NVM_Initialize();
+    if (ImageProgram(argv[1]) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+    if (BL_ApplicationFooterRead(IMAGE_0, &footerData) == false)
+    {
+        fprintf(stderr, "%s: footer cannot be read\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    // Two bytes of every word are fed to the CRC
+    byteCount = 2U * ((footerData.verificationEndAddress + 1U) - footerData.verificationStartAddress);
+
+    startTime = clock();
+    for (uint16_t run = 0U; run < VERIFY_COUNT; run++)
+    {
+        if (BL_ImageVerifyById(IMAGE_0) != BL_PASS)
+        {
+            fprintf(stderr, "BL_CRC32_TABLE_SIZE %u: image does not verify\n", (unsigned int) BL_CRC32_TABLE_SIZE);
+            return EXIT_FAILURE;
+        }
+    }
+    elapsedTime = (double) (clock() - startTime) / CLOCKS_PER_SEC;
+
+    printf("BL_CRC32_TABLE_SIZE %3u: %lu bytes verified, %.2f ns per byte\n", (unsigned int) BL_CRC32_TABLE_SIZE,
+           (unsigned long) byteCount, (elapsedTime * 1e9) / ((double) byteCount * VERIFY_COUNT));
+    return EXIT_SUCCESS;
+}
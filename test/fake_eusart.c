@@ -0,0 +1,112 @@
+/*
+ * RAM-backed stand-in for the MCC EUSART1 and Timer0 drivers that the communication
+ * adapter reaches through the SERCOM_* names. Received bytes are read from a queue the
+ * test fills, and transmitted bytes are collected in a second queue. The baud rate
+ * generator is modeled for a 32 MHz clock with BRG16 and BRGH set, as MCC configures it.
+ */
+
+#include "uart/eusart1.h"
+#include "timer/tmr0.h"
+#include "fake_eusart.h"
+
+#define FAKE_EUSART_CLOCK_FREQUENCY     (32000000UL)
+#define FAKE_EUSART_RESET_BRG_COUNT     (0x44UL)
+
+uint8_t testRxQueue[TEST_QUEUE_SIZE];
+uint16_t testRxHead;
+uint16_t testRxTail;
+uint8_t testTxQueue[TEST_QUEUE_SIZE];
+uint16_t testTxCount;
+uint16_t testRxErrorIndex = TEST_NO_ERROR;
+bool testTimerOverflow;
+
+static uint32_t brgCount;
+static size_t errorStatus;
+
+void EUSART1_Initialize(void)
+{
+    brgCount = FAKE_EUSART_RESET_BRG_COUNT;
+    errorStatus = 0U;
+}
+
+void EUSART1_Deinitialize(void)
+{
+    brgCount = 0U;
+}
+
+void EUSART1_BRGCountSet(uint32_t brgValue)
+{
+    brgCount = brgValue;
+}
+
+uint32_t EUSART1_BRGCountGet(void)
+{
+    return brgCount;
+}
+
+uint32_t EUSART1_BRGCountCalculate(uint32_t baudRate)
+{
+    // Rounded to the closest count
+    return ((FAKE_EUSART_CLOCK_FREQUENCY + (2UL * baudRate)) / (4UL * baudRate)) - 1UL;
+}
+
+uint32_t EUSART1_BaudRateCalculate(uint32_t brgValue)
+{
+    return FAKE_EUSART_CLOCK_FREQUENCY / (4UL * (brgValue + 1UL));
+}
+
+bool EUSART1_IsRxReady(void)
+{
+    return (testRxTail != testRxHead);
+}
+
+bool EUSART1_IsTxReady(void)
+{
+    return true;
+}
+
+bool EUSART1_IsTxDone(void)
+{
+    return true;
+}
+
+size_t EUSART1_ErrorGet(void)
+{
+    return errorStatus;
+}
+
+uint8_t EUSART1_Read(void)
+{
+    // The error status describes the byte just read, as on the device
+    errorStatus = (testRxTail == testRxErrorIndex) ? 1U : 0U;
+    return testRxQueue[testRxTail++];
+}
+
+void EUSART1_Write(uint8_t txData)
+{
+    testTxQueue[testTxCount++] = txData;
+}
+
+void TMR0_Initialize(void)
+{
+    testTimerOverflow = false;
+}
+
+void TMR0_Deinitialize(void)
+{
+    testTimerOverflow = false;
+}
+
+void TMR0_Start(void)
+{
+}
+
+void TMR0_CounterSet(uint16_t counterValue)
+{
+    (void) counterValue;
+}
+
+bool TMR0_OverflowStatusGet(void)
+{
+    return testTimerOverflow;
+}
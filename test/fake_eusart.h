@@ -0,0 +1,27 @@
+/*
+ * Queues and switches of the fake EUSART1 and Timer0 drivers in fake_eusart.c.
+ */
+
+#ifndef FAKE_EUSART_H
+#define FAKE_EUSART_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TEST_QUEUE_SIZE         (1024U)
+#define TEST_NO_ERROR           (0xFFFFU)
+
+// Bytes waiting to be received, from testRxTail up to testRxHead
+extern uint8_t testRxQueue[TEST_QUEUE_SIZE];
+extern uint16_t testRxHead;
+extern uint16_t testRxTail;
+// Bytes transmitted since the test last cleared testTxCount
+extern uint8_t testTxQueue[TEST_QUEUE_SIZE];
+extern uint16_t testTxCount;
+// Queue index of a received byte that reports a framing error
+extern uint16_t testRxErrorIndex;
+// Timer0 overflow flag, cleared whenever the timer is initialized
+extern bool testTimerOverflow;
+
+#endif // FAKE_EUSART_H
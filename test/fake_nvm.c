@@ -0,0 +1,113 @@
+/*
+ * RAM-backed stand-in for the MCC NVM driver. Program Flash and Data EEPROM are
+ * plain arrays, and erase and write operations only succeed with the unlock key set,
+ * as on the device.
+ */
+
+#include <string.h>
+#include "nvm.h"
+
+flash_data_t testFlash[PROGMEM_SIZE];
+eeprom_data_t testEeprom[EEPROM_SIZE];
+
+volatile uint8_t STKPTR;
+volatile uint8_t BSR;
+
+static uint16_t unlockKey;
+
+void NVM_Initialize(void)
+{
+    (void) memset(testEeprom, 0xFF, sizeof (testEeprom));
+    for (flash_address_t address = 0U; address < PROGMEM_SIZE; address++)
+    {
+        testFlash[address] = 0x3FFFU;
+    }
+}
+
+bool NVM_IsBusy(void)
+{
+    return false;
+}
+
+nvm_status_t NVM_StatusGet(void)
+{
+    return NVM_OK;
+}
+
+void NVM_StatusClear(void)
+{
+}
+
+void NVM_UnlockKeySet(uint16_t key)
+{
+    unlockKey = key;
+}
+
+void NVM_UnlockKeyClear(void)
+{
+    unlockKey = 0U;
+}
+
+flash_data_t FLASH_Read(flash_address_t address)
+{
+    return testFlash[address % PROGMEM_SIZE];
+}
+
+nvm_status_t FLASH_RowWrite(flash_address_t address, flash_data_t *dataBuffer)
+{
+    if (unlockKey != UNLOCK_KEY)
+    {
+        return NVM_ERROR;
+    }
+    address = FLASH_PageAddressGet(address) % PROGMEM_SIZE;
+    for (uint16_t offset = 0U; offset < PROGMEM_PAGE_SIZE; offset++)
+    {
+        // Programming can only clear bits
+        testFlash[address + offset] &= (flash_data_t) (dataBuffer[offset] & 0x3FFFU);
+    }
+    return NVM_OK;
+}
+
+nvm_status_t FLASH_PageErase(flash_address_t address)
+{
+    if (unlockKey != UNLOCK_KEY)
+    {
+        return NVM_ERROR;
+    }
+    address = FLASH_PageAddressGet(address) % PROGMEM_SIZE;
+    for (uint16_t offset = 0U; offset < PROGMEM_PAGE_SIZE; offset++)
+    {
+        testFlash[address + offset] = 0x3FFFU;
+    }
+    return NVM_OK;
+}
+
+flash_address_t FLASH_PageAddressGet(flash_address_t address)
+{
+    return address & ~((flash_address_t) PROGMEM_PAGE_SIZE - 1U);
+}
+
+uint16_t FLASH_PageOffsetGet(flash_address_t address)
+{
+    return (uint16_t) (address & (PROGMEM_PAGE_SIZE - 1U));
+}
+
+eeprom_data_t EEPROM_Read(eeprom_address_t address)
+{
+    return testEeprom[(address - EEPROM_START_ADDRESS) % EEPROM_SIZE];
+}
+
+void EEPROM_Write(eeprom_address_t address, eeprom_data_t data)
+{
+    if (unlockKey == UNLOCK_KEY)
+    {
+        testEeprom[(address - EEPROM_START_ADDRESS) % EEPROM_SIZE] = data;
+    }
+}
+
+device_id_data_t DeviceID_Read(device_id_address_t address)
+{
+    (void) address;
+    // PIC16F18446
+    return 0x30D4U;
+}
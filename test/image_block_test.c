@@ -0,0 +1,120 @@
+/*
+ * Feeds image files through BL_BootCommandProcess one chunk at a time, as the FTP does
+ * with each received Write Chunk command. Chunks have the size of the first block of
+ * the file, which is what the host splits the file by. The test checks that a packed
+ * image leaves the same staging area as the image it was built from. A delta image is
+ * built against a base image, which is staged and installed into the execution image
+ * space first.
+ *
+ * Usage: image_block_test <reference.img> <packed.img> [<base.img>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bl_core.h"
+#include "bl_app_verify.h"
+
+#define IMAGE_SIZE_MAX          (0x10000U)
+#define STAGING_WORD_COUNT      (BL_STAGING_IMAGE_END - BL_STAGING_IMAGE_START + 1U)
+
+extern flash_data_t testFlash[PROGMEM_SIZE];
+
+static uint8_t imageData[IMAGE_SIZE_MAX];
+static flash_data_t referenceStaging[STAGING_WORD_COUNT];
+
+static int ImageLoad(const char * path)
+{
+    FILE * imageFile = fopen(path, "rb");
+    size_t imageSize = 0U;
+    size_t blockCount = 0U;
+    size_t index = 0U;
+    uint16_t chunkSize = 0U;
+
+    if (imageFile == NULL)
+    {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return -1;
+    }
+    imageSize = fread(imageData, 1U, sizeof (imageData), imageFile);
+    (void) fclose(imageFile);
+    if (imageSize >= 2U)
+    {
+        chunkSize = (uint16_t) (imageData[0] | (imageData[1] << 8U));
+    }
+
+    // Program the staging area with a pattern that every written page must replace
+    for (uint16_t offset = 0U; offset < STAGING_WORD_COUNT; offset++)
+    {
+        testFlash[BL_STAGING_IMAGE_START + offset] = 0x1234U;
+    }
+
+    while (index < imageSize)
+    {
+        uint16_t blockLength = (uint16_t) (imageData[index] | (imageData[index + 1U] << 8U));
+        bl_result_t blockStatus = BL_FAIL;
+
+        if ((chunkSize < BL_BLOCK_HEADER_SIZE) || (blockLength > chunkSize) || ((index + chunkSize) > imageSize))
+        {
+            fprintf(stderr, "%s: malformed block at offset 0x%zx\n", path, index);
+            return -1;
+        }
+        blockStatus = BL_BootCommandProcess(&imageData[index], chunkSize);
+        if (blockStatus != BL_PASS)
+        {
+            fprintf(stderr, "%s: block %zu of type 0x%02x failed with 0x%02x\n", path, blockCount, imageData[index + 2U], blockStatus);
+            return -1;
+        }
+        index += chunkSize;
+        blockCount++;
+    }
+
+    if ((BL_StagingAreaFinalize() != BL_PASS) || (BL_ImageVerify() != BL_PASS))
+    {
+        fprintf(stderr, "%s: staged image does not verify\n", path);
+        return -1;
+    }
+    printf("%s: %zu blocks, %zu bytes\n", path, blockCount, imageSize);
+    return 0;
+}
+
+int main(int argc, char ** argv)
+{
+    if ((argc != 3) && (argc != 4))
+    {
+        fprintf(stderr, "usage: %s <reference.img> <packed.img> [<base.img>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    NVM_Initialize();
+    if (argc == 4)
+    {
+        if (ImageLoad(argv[3]) != 0)
+        {
+            return EXIT_FAILURE;
+        }
+        // Install the base image the way BL_CopyImageAreas leaves it
+        (void) memcpy(&testFlash[BL_APPLICATION_START_ADDRESS], &testFlash[BL_STAGING_IMAGE_START], sizeof (referenceStaging));
+    }
+    if (ImageLoad(argv[1]) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+    (void) memcpy(referenceStaging, &testFlash[BL_STAGING_IMAGE_START], sizeof (referenceStaging));
+
+    if (ImageLoad(argv[2]) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+    for (uint16_t offset = 0U; offset < STAGING_WORD_COUNT; offset++)
+    {
+        if (testFlash[BL_STAGING_IMAGE_START + offset] != referenceStaging[offset])
+        {
+            fprintf(stderr, "staging word 0x%04x is 0x%04x, expected 0x%04x\n", BL_STAGING_IMAGE_START + offset,
+                    testFlash[BL_STAGING_IMAGE_START + offset], referenceStaging[offset]);
+            return EXIT_FAILURE;
+        }
+    }
+    printf("staging areas match\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,23 @@
+/*
+ * Host stand-in for the XC8 device header. It declares only the registers and
+ * qualifiers that the bootloader core sources touch when built with gcc.
+ */
+#ifndef TEST_STUB_XC_H
+#define TEST_STUB_XC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t uint24_t;
+
+#define __bit _Bool
+#define __persistent
+#define __at(address)
+#define ___mkstr1(x) #x
+#define ___mkstr(x) ___mkstr1(x)
+#define asm(instruction) ((void) 0)
+
+extern volatile uint8_t STKPTR;
+extern volatile uint8_t BSR;
+
+#endif /* TEST_STUB_XC_H */
@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+"""
+Rewrites the WRITE_FLASH blocks of an application image built by pyfwimagebuilder as
+WRITE_FLASH_COMPRESSED blocks, or as WRITE_FLASH_DELTA blocks against the image that
+is running on the device, for the PIC16 MDFU client.
+
+A compressed block carries the usual command header followed by a token stream:
+  - token bit 7 set:   (token & 0x7F) + 1 erased words, no data follows
+  - token bit 7 clear: (token & 0x7F) + 1 literal words follow, packed LSB first at
+                       14 bits per word and padded to a whole byte
+A delta block uses the same literal tokens, but a token with bit 7 set copies
+(token & 0x7F) + 1 words from the execution image space, starting at the 16-bit
+little-endian word offset that follows the token. This encoder only copies words that
+are unchanged at the same offset of the base image.
+
+A block always decodes to whole Flash pages. Every block of the output image is padded
+to the block size of the input image, so the host still splits the file at the size the
+client advertises. The unused bytes after blockLength are ignored by the client.
+
+Usage:
+    python pack_image.py -i Application_Binary_v1.img -o Application_Binary_v1_compressed.img
+    python pack_image.py -i Application_Binary_v2.img -b Application_Binary_v1.img -o Application_Binary_v2_delta.img
+"""
+
+import argparse
+import struct
+import sys
+
+UNLOCK_BOOTLOADER = 0x01
+WRITE_FLASH = 0x02
+WRITE_FLASH_COMPRESSED = 0x04
+WRITE_FLASH_DELTA = 0x05
+
+BLOCK_HEADER_SIZE = 3
+COMMAND_HEADER_SIZE = 12
+UNLOCK_METADATA_SIZE = 9
+PAGE_WORDS = 32
+WORD_BITS = 14
+ERASED_WORD = 0x3FFF
+RUN_MAX = 128
+COMPRESSED_FORMAT_MINOR = 0x04
+DELTA_FORMAT_MINOR = 0x05
+
+
+def read_blocks(path):
+    """Splits an image file into (blockType, blockBytes) tuples."""
+    with open(path, "rb") as image_file:
+        data = image_file.read()
+    blocks = []
+    index = 0
+    while index < len(data):
+        length = struct.unpack_from("<H", data, index)[0]
+        if length < BLOCK_HEADER_SIZE or index + length > len(data):
+            raise ValueError(f"{path}: malformed block at offset {index:#x}")
+        blocks.append((data[index + 2], data[index:index + length]))
+        index += length
+    return blocks
+
+
+def page_address(block):
+    return struct.unpack_from("<I", block, BLOCK_HEADER_SIZE)[0]
+
+
+def page_words(block):
+    payload = block[BLOCK_HEADER_SIZE + COMMAND_HEADER_SIZE:]
+    if len(payload) != PAGE_WORDS * 2:
+        raise ValueError(f"WRITE_FLASH block at {page_address(block):#x} does not hold one page")
+    return list(struct.unpack(f"<{PAGE_WORDS}H", payload))
+
+
+def literal_tokens(words):
+    """Encodes up to RUN_MAX words as one literal token."""
+    stream = bytearray([len(words) - 1])
+    bit_buffer = 0
+    bit_count = 0
+    for word in words:
+        bit_buffer |= (word & ERASED_WORD) << bit_count
+        bit_count += WORD_BITS
+        while bit_count >= 8:
+            stream.append(bit_buffer & 0xFF)
+            bit_buffer >>= 8
+            bit_count -= 8
+    if bit_count > 0:
+        stream.append(bit_buffer & 0xFF)
+    return stream
+
+
+def compress(words):
+    """Encodes a word list as a compressed token stream."""
+    stream = bytearray()
+    index = 0
+    while index < len(words):
+        end = index
+        if index + 1 < len(words) and words[index] == ERASED_WORD and words[index + 1] == ERASED_WORD:
+            while end < len(words) and words[end] == ERASED_WORD and end - index < RUN_MAX:
+                end += 1
+            stream.append(0x80 | (end - index - 1))
+        else:
+            # A single erased word costs less as a literal than as a token of its own
+            while (end < len(words) and end - index < RUN_MAX
+                   and not (end + 1 < len(words) and words[end] == ERASED_WORD and words[end + 1] == ERASED_WORD)):
+                end += 1
+            stream += literal_tokens(words[index:end])
+        index = end
+    return stream
+
+
+def base_words_get(blocks):
+    """Maps every word address written by an image to its value."""
+    words = {}
+    for block_kind, block in blocks:
+        if block_kind == WRITE_FLASH:
+            address = page_address(block)
+            for offset, word in enumerate(page_words(block)):
+                words[address + offset] = word
+    return words
+
+
+def delta(address, words, base, image_start):
+    """Encodes a word list as a delta token stream against the base image words."""
+    stream = bytearray()
+    index = 0
+
+    def unchanged(position):
+        return base.get(address + position) == words[position]
+
+    while index < len(words):
+        end = index
+        if index + 1 < len(words) and unchanged(index) and unchanged(index + 1):
+            while end < len(words) and unchanged(end) and end - index < RUN_MAX:
+                end += 1
+            stream.append(0x80 | (end - index - 1))
+            stream += struct.pack("<H", address + index - image_start)
+        else:
+            # A single unchanged word costs less as a literal than as a copy token
+            while (end < len(words) and end - index < RUN_MAX
+                   and not (end + 1 < len(words) and unchanged(end) and unchanged(end + 1))):
+                end += 1
+            stream += literal_tokens(words[index:end])
+        index = end
+    return stream
+
+
+def pack(blocks, encode, block_type):
+    """Groups contiguous pages into the fewest blocks whose streams fit the block size."""
+    block_size = len(blocks[0][1])
+    capacity = block_size - BLOCK_HEADER_SIZE - COMMAND_HEADER_SIZE
+    output = []
+    pages = []
+
+    def flush():
+        first = 0
+        while first < len(pages):
+            last = first + 1
+            stream = encode(pages[first][0], pages[first][1])
+            while last < len(pages):
+                words = [word for page in pages[first:last + 1] for word in page[1]]
+                candidate = encode(pages[first][0], words)
+                if len(candidate) > capacity:
+                    break
+                stream = candidate
+                last += 1
+            if len(stream) > capacity:
+                # The page does not compress; keep the raw block
+                output.append(pages[first][2])
+            else:
+                header = pages[first][2][BLOCK_HEADER_SIZE:BLOCK_HEADER_SIZE + COMMAND_HEADER_SIZE]
+                length = BLOCK_HEADER_SIZE + COMMAND_HEADER_SIZE + len(stream)
+                block = struct.pack("<HB", length, block_type) + header + stream
+                output.append(block + bytes(block_size - len(block)))
+            first = last
+        pages.clear()
+
+    for block_kind, block in blocks:
+        if block_kind == WRITE_FLASH:
+            address = page_address(block)
+            if pages and address != pages[-1][0] + PAGE_WORDS:
+                flush()
+            pages.append((address, page_words(block), block))
+        else:
+            flush()
+            output.append(block)
+    flush()
+    return output
+
+
+def format_minor_set(blocks, minor):
+    """Raises the image format minor version carried by the unlock block."""
+    for index, (block_kind, block) in enumerate(blocks):
+        if block_kind == UNLOCK_BOOTLOADER:
+            block = bytearray(block)
+            block[BLOCK_HEADER_SIZE + 1] = max(block[BLOCK_HEADER_SIZE + 1], minor)
+            blocks[index] = (block_kind, bytes(block))
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0].strip())
+    parser.add_argument("-i", "--input", required=True, help="image file built by pyfwimagebuilder")
+    parser.add_argument("-o", "--output", required=True, help="image file to write")
+    parser.add_argument("-b", "--base", help="image running on the device; writes delta blocks against it")
+    args = parser.parse_args(argv)
+
+    blocks = read_blocks(args.input)
+    if not blocks or blocks[0][0] != UNLOCK_BOOTLOADER:
+        parser.error(f"{args.input} does not start with an unlock block")
+    if any(len(block) != len(blocks[0][1]) for _, block in blocks):
+        parser.error(f"{args.input} does not use one block size")
+
+    if args.base is None:
+        format_minor_set(blocks, COMPRESSED_FORMAT_MINOR)
+        output = pack(blocks, lambda address, words: compress(words), WRITE_FLASH_COMPRESSED)
+    else:
+        base = base_words_get(read_blocks(args.base))
+        image_start = struct.unpack_from("<I", blocks[0][1], BLOCK_HEADER_SIZE + UNLOCK_METADATA_SIZE)[0]
+        format_minor_set(blocks, DELTA_FORMAT_MINOR)
+        output = pack(blocks, lambda address, words: delta(address, words, base, image_start), WRITE_FLASH_DELTA)
+
+    with open(args.output, "wb") as image_file:
+        image_file.write(b"".join(output))
+    input_size = sum(len(block) for _, block in blocks)
+    output_size = sum(len(block) for block in output)
+    print(f"{args.output}: {len(blocks)} blocks, {input_size} bytes -> {len(output)} blocks, {output_size} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())